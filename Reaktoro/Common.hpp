@@ -35,12 +35,14 @@
 #include <Reaktoro/Common/MoleFractionUtils.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Common/TableUtils.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
@@ -22,6 +22,7 @@ void exportConstants(py::module& m);
 void exportInterpolationUtils(py::module& m);
 void exportMemoization(py::module& m);
 void exportParseUtils(py::module& m);
+void exportProfiler(py::module& m);
 void exportStringList(py::module& m);
 void exportStringUtils(py::module& m);
 void exportTable(py::module& m);
@@ -36,6 +37,7 @@ void exportCommon(py::module& m)
     exportInterpolationUtils(m);
     exportMemoization(m);
     exportParseUtils(m);
+    exportProfiler(m);
     exportStringList(m);
     exportStringUtils(m);
     exportTable(m);
@@ -140,6 +140,12 @@ using MatrixXdConstRef        = Eigen::Ref<const MatrixXd>; ///< Convenient alia
 using MatrixXdMap             = Eigen::Map<MatrixXd>;       ///< Convenient alias to Eigen type.
 using MatrixXdConstMap        = Eigen::Map<const MatrixXd>; ///< Convenient alias to Eigen type.
 
+using MatrixXf                = Eigen::MatrixXf;            ///< Convenient alias to Eigen type.
+using MatrixXfRef             = Eigen::Ref<MatrixXf>;       ///< Convenient alias to Eigen type.
+using MatrixXfConstRef        = Eigen::Ref<const MatrixXf>; ///< Convenient alias to Eigen type.
+using MatrixXfMap             = Eigen::Map<MatrixXf>;       ///< Convenient alias to Eigen type.
+using MatrixXfConstMap        = Eigen::Map<const MatrixXf>; ///< Convenient alias to Eigen type.
+
 //---------------------------------------------------------------------------------------------------------------------
 // == ROW VECTOR TYPE ALIASES ==
 //---------------------------------------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Meta.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
 
@@ -140,18 +141,29 @@ public:
 };
 
 /// Return a memoized version of given function `f`.
+/// The cache of the memoized function, as well as the copy of `f` it calls,
+/// are kept per thread so that the memoized function can be shared among
+/// threads (see @ref ThreadLocal).
 template<typename Ret, typename... Args>
 auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    auto cache = std::make_shared<Map<Tuple<Args...>, Ret>>();
-    return [=](Args... args) mutable -> Ret
+    struct Memo
     {
+        Fn<Ret(Args...)> f;
+        Map<Tuple<Args...>, Ret> cache;
+    };
+
+    ThreadLocal<Memo> memo(Memo{f, {}});
+
+    return [=](Args... args) -> Ret
+    {
+        auto& [f, cache] = memo.local();
         if(Memoization::isDisabled())
             return f(args...);
         Tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        if(cache.find(t) == cache.end())
+            cache[t] = f(args...);
+        return cache[t];
     };
 }
 
@@ -163,14 +175,25 @@ auto memoize(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// The cache of the memoized function, as well as the copy of `f` it calls,
+/// are kept per thread so that the memoized function can be shared among
+/// threads (see @ref ThreadLocal).
 template<typename Ret, typename... Args>
 auto memoizeLast(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](Args... args) mutable -> Ret
+    struct Memo
+    {
+        Fn<Ret(Args...)> f;
+        Tuple<detail::CacheType<Args>...> cache;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+
+    ThreadLocal<Memo> memo(Memo{f});
+
+    return [=](Args... args) -> Ret
     {
+        auto& [f, cache, result, firsttime] = memo.local();
         if(Memoization::isDisabled())
             return f(args...);
         if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
@@ -189,14 +212,25 @@ auto memoizeLast(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// The cache of the memoized function, as well as the copy of `f` it calls,
+/// are kept per thread so that the memoized function can be shared among
+/// threads (see @ref ThreadLocal).
 template<typename Ret, typename RetRef, typename... Args>
 auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](RetRef res, Args... args) mutable -> void
+    struct Memo
+    {
+        Fn<void(RetRef, Args...)> f;
+        Tuple<detail::CacheType<Args>...> cache;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+
+    ThreadLocal<Memo> memo(Memo{f});
+
+    return [=](RetRef res, Args... args) -> void
     {
+        auto& [f, cache, result, firsttime] = memo.local();
         if(Memoization::isDisabled())
             f(res, args...);
         else if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
@@ -0,0 +1,207 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Profiler.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <unordered_set>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The flag indicating if the collection of timing data is enabled.
+std::atomic<bool> profiling{false};
+
+/// A node in the tree of nested scopes of a thread.
+struct ScopeNode
+{
+    const char* name = nullptr;   ///< The name of the scope (its address identifies the scope).
+    double time = 0.0;            ///< The accumulated elapsed time in the scope.
+    Index calls = 0;              ///< The number of times the scope was entered.
+    ScopeNode* parent = nullptr;  ///< The enclosing scope (null for the root node).
+    Vec<Ptr<ScopeNode>> children; ///< The scopes nested in this scope.
+};
+
+/// Merge the timing data in a tree of nested scopes of a thread into a profile tree.
+auto merge(ProfilerNode& dest, ScopeNode const& src) -> void
+{
+    dest.time += src.time;
+    dest.calls += src.calls;
+    for(auto const& child : src.children)
+    {
+        if(child->calls == 0) // skip scopes not entered since the last reset
+            continue;
+        auto it = std::find_if(dest.children.begin(), dest.children.end(), [&](ProfilerNode const& node) { return node.name == child->name; });
+        if(it == dest.children.end())
+        {
+            dest.children.push_back({ child->name });
+            it = dest.children.end() - 1;
+        }
+        merge(*it, *child);
+    }
+}
+
+/// Remove the timing data in a tree of nested scopes of a thread, keeping the nodes (which may be in use).
+auto clear(ScopeNode& node) -> void
+{
+    node.time = 0.0;
+    node.calls = 0;
+    for(auto& child : node.children)
+        clear(*child);
+}
+
+/// Write the timing data of a profile tree in the folded stacks format.
+auto folded(std::ostream& out, ProfilerNode const& node, String const& stack) -> void
+{
+    auto self = node.time;
+    for(auto const& child : node.children)
+        self -= child.time;
+    if(!stack.empty() && node.calls > 0)
+        out << stack << " " << static_cast<long long>(std::max(self, 0.0) * 1e6) << "\n";
+    for(auto const& child : node.children)
+        folded(out, child, stack.empty() ? child.name : stack + ";" + child.name);
+}
+
+struct ThreadProfile;
+
+/// The registry of the profiles of all threads.
+struct ProfileRegistry
+{
+    std::mutex mutex;                 ///< The mutex used to synchronize the threads with the registry.
+    Vec<ThreadProfile*> threads;      ///< The profiles of the threads currently alive.
+    ProfilerNode retired;             ///< The timing data of the threads that already terminated.
+};
+
+/// Return the registry of the profiles of all threads.
+auto registry() -> ProfileRegistry&
+{
+    static ProfileRegistry instance;
+    return instance;
+}
+
+/// The tree of nested scopes of a thread.
+struct ThreadProfile
+{
+    ScopeNode root;             ///< The root node of the tree of nested scopes.
+    ScopeNode* current = &root; ///< The innermost scope currently entered by the thread.
+
+    ThreadProfile()
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.push_back(this);
+    }
+
+    ~ThreadProfile()
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        merge(reg.retired, root);
+        reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), this));
+    }
+};
+
+/// Return the tree of nested scopes of the current thread.
+auto threadProfile() -> ThreadProfile&
+{
+    thread_local ThreadProfile profile;
+    return profile;
+}
+
+} // namespace
+
+auto Profiler::enable(bool active) -> void
+{
+    profiling.store(active, std::memory_order_relaxed);
+}
+
+auto Profiler::enabled() -> bool
+{
+    return profiling.load(std::memory_order_relaxed);
+}
+
+auto Profiler::report() -> ProfilerNode
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    ProfilerNode result = reg.retired;
+    for(auto const* thread : reg.threads)
+        merge(result, thread->root);
+    result.time = 0.0;
+    for(auto const& child : result.children)
+        result.time += child.time;
+    return result;
+}
+
+auto Profiler::reset() -> void
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.retired = {};
+    for(auto* thread : reg.threads)
+        clear(thread->root);
+}
+
+auto Profiler::outputFolded(String const& filename) -> void
+{
+    std::ofstream file(filename);
+    errorif(!file, "Could not open file `", filename, "` for writing the profiling data.");
+    folded(file, report(), "");
+}
+
+auto Profiler::intern(String const& name) -> const char*
+{
+    static std::mutex mutex;
+    static std::unordered_set<String> names; // the addresses of its elements are not changed by rehashing
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.insert(name).first->c_str();
+}
+
+auto Profiler::enter(const char* name) -> void
+{
+    auto& profile = threadProfile();
+    auto& children = profile.current->children;
+
+    // Scopes are identified by the addresses of their names (string literals) to avoid string comparisons in hot paths
+    auto it = std::find_if(children.begin(), children.end(), [&](Ptr<ScopeNode> const& node) { return node->name == name; });
+    if(it == children.end())
+    {
+        children.emplace_back(new ScopeNode{ name, 0.0, 0, profile.current });
+        it = children.end() - 1;
+    }
+
+    profile.current = it->get();
+}
+
+auto Profiler::leave(double elapsed) -> void
+{
+    auto& profile = threadProfile();
+    auto node = profile.current;
+    errorif(node->parent == nullptr, "Could not leave a profiled scope because no scope was entered in the current thread.");
+    node->time += elapsed;
+    node->calls += 1;
+    profile.current = node->parent;
+}
+
+} // namespace Reaktoro
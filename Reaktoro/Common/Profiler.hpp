@@ -0,0 +1,139 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The accumulated timing data of a named scope in a hierarchical profile.
+struct ProfilerNode
+{
+    /// The name of the scope (empty for the root node of a profile).
+    String name;
+
+    /// The accumulated elapsed time in the scope (in s), including the time in its nested scopes.
+    double time = 0.0;
+
+    /// The number of times the scope was entered.
+    Index calls = 0;
+
+    /// The scopes nested in this scope.
+    Vec<ProfilerNode> children;
+};
+
+/// Used to collect timing data of named scopes (see @ref REAKTORO_PROFILE_SCOPE).
+/// Every thread accumulates the timing data of its scopes in its own tree of
+/// nested scopes (so that no locks are needed in hot paths), and these trees
+/// are merged by scope names in @ref report. The collection is disabled by
+/// default and can be enabled at runtime with @ref enable. When compiled with
+/// `REAKTORO_DISABLE_PROFILING`, the instrumented scopes are removed altogether.
+class Profiler
+{
+public:
+    /// Enable or disable the collection of timing data at runtime.
+    static auto enable(bool active) -> void;
+
+    /// Return true if the collection of timing data is enabled.
+    static auto enabled() -> bool;
+
+    /// Return the timing data of all threads merged in a single tree of nested scopes.
+    /// This should be called when no other thread is inside an instrumented scope.
+    static auto report() -> ProfilerNode;
+
+    /// Remove the timing data collected so far in all threads.
+    /// This should be called when no other thread is inside an instrumented scope.
+    static auto reset() -> void;
+
+    /// Write the timing data of all threads in the folded stacks format used by flame graph tools.
+    /// Each line contains the names of nested scopes separated by semicolons
+    /// followed by the time spent in the innermost scope only (in μs).
+    static auto outputFolded(String const& filename) -> void;
+
+    /// Return a copy of given scope name whose address remains valid until the end of the program.
+    /// Equal names return the same address, so that scopes with names built at runtime (e.g.,
+    /// from the name of a phase) can be identified like those named with string literals.
+    static auto intern(String const& name) -> const char*;
+
+    /// Enter a named scope in the current thread (use @ref REAKTORO_PROFILE_SCOPE instead).
+    static auto enter(const char* name) -> void;
+
+    /// Leave the current named scope in the current thread (use @ref REAKTORO_PROFILE_SCOPE instead).
+    static auto leave(double elapsed) -> void;
+};
+
+/// Used to time a named scope from its construction to its destruction (see @ref REAKTORO_PROFILE_SCOPE).
+class ProfilerScope
+{
+public:
+    /// Construct a ProfilerScope object and enter the named scope (if profiling is enabled).
+    /// @param name The name of the scope (a string literal or a name returned by Profiler::intern, since its address is used to identify the scope; null to enter no scope)
+    explicit ProfilerScope(const char* name)
+    : mactive(name && Profiler::enabled())
+    {
+        if(mactive)
+        {
+            Profiler::enter(name);
+            mstart = time();
+        }
+    }
+
+    /// Destroy this ProfilerScope object and leave the named scope.
+    ~ProfilerScope()
+    {
+        if(mactive)
+            Profiler::leave(elapsed(mstart));
+    }
+
+    ProfilerScope(ProfilerScope const&) = delete;
+
+    auto operator=(ProfilerScope const&) -> ProfilerScope& = delete;
+
+private:
+    /// The flag indicating if profiling was enabled when entering the scope.
+    bool mactive;
+
+    /// The time point at which the scope was entered.
+    Time mstart;
+};
+
+#define REAKTORO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define REAKTORO_PROFILE_CONCAT(a, b) REAKTORO_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef REAKTORO_DISABLE_PROFILING
+
+/// Macro to time the enclosing scope with given name (a string literal) in the hierarchical profile of the current thread.
+#define REAKTORO_PROFILE_SCOPE(name)
+
+/// Macro to time the enclosing scope with given name built at runtime (a String expression) in the hierarchical profile of the current thread.
+#define REAKTORO_PROFILE_SCOPE_NAMED_AT_RUNTIME(name)
+
+#else
+
+/// Macro to time the enclosing scope with given name (a string literal) in the hierarchical profile of the current thread.
+#define REAKTORO_PROFILE_SCOPE(name) ProfilerScope REAKTORO_PROFILE_CONCAT(reaktoro_profiler_scope_, __LINE__)(name)
+
+/// Macro to time the enclosing scope with given name built at runtime (a String expression) in the hierarchical profile of the current thread.
+/// The name is only evaluated if profiling is enabled, so that building it has no cost otherwise.
+#define REAKTORO_PROFILE_SCOPE_NAMED_AT_RUNTIME(name) ProfilerScope REAKTORO_PROFILE_CONCAT(reaktoro_profiler_scope_, __LINE__)(Profiler::enabled() ? Profiler::intern(name) : nullptr)
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
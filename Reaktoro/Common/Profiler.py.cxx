@@ -0,0 +1,42 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+using namespace Reaktoro;
+
+void exportProfiler(py::module& m)
+{
+    py::class_<ProfilerNode>(m, "ProfilerNode")
+        .def(py::init<>())
+        .def_readwrite("name", &ProfilerNode::name, "The name of the scope (empty for the root node of a profile).")
+        .def_readwrite("time", &ProfilerNode::time, "The accumulated elapsed time in the scope (in s), including the time in its nested scopes.")
+        .def_readwrite("calls", &ProfilerNode::calls, "The number of times the scope was entered.")
+        .def_readwrite("children", &ProfilerNode::children, "The scopes nested in this scope.")
+        ;
+
+    py::class_<Profiler>(m, "Profiler")
+        .def_static("enable", &Profiler::enable, "Enable or disable the collection of timing data at runtime.")
+        .def_static("enabled", &Profiler::enabled, "Return true if the collection of timing data is enabled.")
+        .def_static("report", &Profiler::report, "Return the timing data of all threads merged in a single tree of nested scopes.")
+        .def_static("reset", &Profiler::reset, "Remove the timing data collected so far in all threads.")
+        .def_static("outputFolded", &Profiler::outputFolded, "Write the timing data of all threads in the folded stacks format used by flame graph tools.")
+        ;
+}
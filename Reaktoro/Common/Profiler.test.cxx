@@ -0,0 +1,121 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+auto findChild(ProfilerNode const& node, String const& name) -> ProfilerNode const*
+{
+    for(auto const& child : node.children)
+        if(child.name == name)
+            return &child;
+    return nullptr;
+}
+
+auto work()
+{
+    REAKTORO_PROFILE_SCOPE("outer");
+    for(auto i = 0; i < 3; ++i)
+    {
+        REAKTORO_PROFILE_SCOPE("inner");
+    }
+}
+
+} // namespace
+
+TEST_CASE("Testing Profiler", "[Profiler]")
+{
+    Profiler::reset();
+
+    SECTION("Checking nothing is collected when profiling is disabled")
+    {
+        Profiler::enable(false);
+        work();
+        CHECK( Profiler::report().children.empty() );
+    }
+
+#ifndef REAKTORO_DISABLE_PROFILING
+    SECTION("Checking scopes with names built at runtime")
+    {
+        Profiler::enable(true);
+
+        for(String phase : { "AqueousPhase", "GaseousPhase", "AqueousPhase" })
+        {
+            REAKTORO_PROFILE_SCOPE_NAMED_AT_RUNTIME("ActivityModel(" + phase + ")");
+        }
+
+        Profiler::enable(false);
+
+        const auto report = Profiler::report();
+
+        const auto aqueous = findChild(report, "ActivityModel(AqueousPhase)");
+        const auto gaseous = findChild(report, "ActivityModel(GaseousPhase)");
+        REQUIRE( aqueous );
+        REQUIRE( gaseous );
+        CHECK( aqueous->calls == 2 );
+        CHECK( gaseous->calls == 1 );
+
+        Profiler::reset();
+    }
+#endif
+
+#ifndef REAKTORO_DISABLE_PROFILING
+    SECTION("Checking the hierarchical accumulation of timing data of all threads")
+    {
+        Profiler::enable(true);
+
+        work();
+
+        std::thread thread([] { work(); work(); });
+        thread.join();
+
+        Profiler::enable(false);
+
+        const auto report = Profiler::report();
+
+        const auto outer = findChild(report, "outer");
+        REQUIRE( outer );
+        CHECK( outer->calls == 3 );
+        CHECK( outer->time >= 0.0 );
+        CHECK( report.time == Approx(outer->time) );
+
+        const auto inner = findChild(*outer, "inner");
+        REQUIRE( inner );
+        CHECK( inner->calls == 9 );
+        CHECK( inner->time <= outer->time );
+        CHECK( inner->children.empty() );
+
+        CHECK( findChild(report, "inner") == nullptr );
+
+        CHECK( Profiler::intern("inner") == Profiler::intern(String("in") + "ner") );
+        CHECK( Profiler::intern("inner") != Profiler::intern("outer") );
+
+        Profiler::reset();
+
+        CHECK( Profiler::report().children.empty() );
+    }
+#endif
+}
@@ -0,0 +1,143 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// Return a new unique identifier for a ThreadLocal object.
+inline auto nextThreadLocalID() -> Index
+{
+    static std::atomic<Index> counter{0};
+    return counter++;
+}
+
+} // namespace detail
+
+/// Used to hold a separate instance of an object of type `T` for every thread accessing it.
+/// A ThreadLocal object keeps a *prototype* value that is never modified.
+/// The first time a thread calls @ref local, a copy of this prototype is
+/// created for that thread. This permits objects shared among threads (e.g.,
+/// memoized model functions stored in Phase and Species objects, which are
+/// shared by all copies of a ChemicalSystem object) to keep mutable caches and
+/// workspaces without data races. Copies of a ThreadLocal object share the same
+/// per-thread instances (e.g., copies of a memoized function share its caches).
+///
+/// Since every thread calls its own copy of a function wrapped in a
+/// ThreadLocal object, model functions must not capture state objects that
+/// they modify through a pointer created before the function is copied,
+/// because all copies would then write to the same object. Such state objects
+/// (e.g., the AqueousMixtureState in aqueous activity models) are instead
+/// allocated by the model function on its first evaluation, so that each copy
+/// of the function allocates its own.
+///
+/// The instance of the first thread calling @ref local is stored in the
+/// ThreadLocal object itself, so that this thread (e.g., the only one in a
+/// single-threaded application) accesses it with a single comparison of thread
+/// identifiers. Other threads find their instances in a hash table per thread.
+template<typename T>
+class ThreadLocal
+{
+public:
+    /// Construct a ThreadLocal object whose per-thread instances are default constructed.
+    ThreadLocal()
+    : ThreadLocal(T())
+    {}
+
+    /// Construct a ThreadLocal object whose per-thread instances are copies of given `prototype`.
+    explicit ThreadLocal(T const& prototype)
+    : m_data(std::make_shared<Data>(prototype))
+    {}
+
+    /// Return the instance of the object of type `T` that belongs to the calling thread.
+    auto local() const -> T&
+    {
+        auto& data = *m_data;
+
+        const auto thisthread = std::this_thread::get_id();
+
+        // The fast path for the thread that first accessed this object (its instance is never accessed by other threads)
+        if(data.owner.load(std::memory_order_relaxed) == thisthread)
+            return *data.ownerinstance;
+
+        // The first thread accessing this object becomes its owner
+        std::thread::id noowner;
+        if(data.owner.compare_exchange_strong(noowner, thisthread))
+            return data.ownerinstance.emplace(data.prototype);
+
+        return localFromTable();
+    }
+
+private:
+    /// The data shared among copies of a ThreadLocal object.
+    struct Data
+    {
+        /// Construct a Data object with given prototype.
+        explicit Data(T const& prototype)
+        : prototype(prototype), id(detail::nextThreadLocalID())
+        {}
+
+        /// The object from which the per-thread instances are copy constructed.
+        const T prototype;
+
+        /// The unique identifier of this ThreadLocal object (used as key for its per-thread instances in other threads).
+        const Index id;
+
+        /// The identifier of the thread that first accessed this object.
+        std::atomic<std::thread::id> owner;
+
+        /// The instance of the thread that first accessed this object.
+        Optional<T> ownerinstance;
+    };
+
+    /// Return the instance of the calling thread (other than the owner) stored in its hash table.
+    auto localFromTable() const -> T&
+    {
+        /// The per-thread instances of all ThreadLocal<T> objects accessed in the calling thread.
+        thread_local Map<Index, Pair<std::weak_ptr<Data>, T>> instances;
+
+        /// The number of instances above which expired ones are erased.
+        thread_local std::size_t purgesize = 16;
+
+        const auto it = instances.find(m_data->id);
+        if(it != instances.end())
+            return it->second.second;
+
+        if(instances.size() >= purgesize)
+        {
+            for(auto jt = instances.begin(); jt != instances.end();)
+                jt = jt->second.first.expired() ? instances.erase(jt) : std::next(jt);
+            purgesize = std::max<std::size_t>(16, 2 * instances.size());
+        }
+
+        return instances.emplace(m_data->id, Pair<std::weak_ptr<Data>, T>(m_data, m_data->prototype)).first->second.second;
+    }
+
+    /// The data shared among copies of this ThreadLocal object.
+    SharedPtr<Data> m_data;
+};
+
+} // namespace Reaktoro
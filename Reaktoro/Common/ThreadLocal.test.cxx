@@ -0,0 +1,85 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadLocal", "[ThreadLocal]")
+{
+    ThreadLocal<Vec<double>> a(Vec<double>{1.0, 2.0});
+
+    a.local().push_back(3.0);
+
+    CHECK( a.local() == Vec<double>{1.0, 2.0, 3.0} );
+
+    std::thread([&] { CHECK( a.local() == Vec<double>{1.0, 2.0} ); }).join(); // another thread gets a fresh copy of the prototype
+
+    ThreadLocal<Vec<double>> b(a);
+
+    CHECK( b.local() == Vec<double>{1.0, 2.0, 3.0} ); // a copy shares the per-thread instances of the original
+
+    b.local().push_back(4.0);
+
+    CHECK( a.local() == Vec<double>{1.0, 2.0, 3.0, 4.0} );
+
+    std::thread([&] {
+        a.local().push_back(5.0);
+        CHECK( b.local() == Vec<double>{1.0, 2.0, 5.0} ); // also in a thread other than the first one accessing the object
+    }).join();
+
+    CHECK( b.local() == Vec<double>{1.0, 2.0, 3.0, 4.0} );
+}
+
+TEST_CASE("Testing memoizeLast with multiple threads", "[ThreadLocal]")
+{
+    // A function with mutable state that must not be shared among threads
+    auto f = [buffer = Vec<double>()](double x) mutable
+    {
+        buffer.assign(100, x);
+        auto sum = 0.0;
+        for(auto const& value : buffer)
+            sum += value;
+        return sum;
+    };
+
+    auto g = memoizeLast(Fn<double(double)>(f));
+
+    Vec<std::thread> threads;
+    Vec<int> failures(4, 0);
+
+    for(auto k = 0; k < 4; ++k)
+        threads.emplace_back([&, k] {
+            for(auto i = 0; i < 10000; ++i)
+            {
+                const auto x = double(k + i % 3);
+                failures[k] += g(x) != 100 * x;
+            }
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == Vec<int>(4, 0) );
+}
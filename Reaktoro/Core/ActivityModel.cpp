@@ -18,6 +18,36 @@
 #include "ActivityModel.hpp"
 
 namespace Reaktoro {
+namespace {
+
+/// The function object stored in an ActivityModelGenerator created with withActivityDerivs.
+struct ActivityModelGeneratorWithDerivs
+{
+    /// The generator of the activity models.
+    ActivityModelGenerator model;
+
+    /// The generator of the analytic derivatives of the activity models.
+    ActivityDerivsModelGenerator derivs;
+
+    /// Construct the activity model of a phase with given species.
+    auto operator()(SpeciesList const& species) const -> ActivityModel
+    {
+        return model(species);
+    }
+};
+
+} // namespace
+
+auto withActivityDerivs(ActivityModelGenerator const& model, ActivityDerivsModelGenerator const& derivs) -> ActivityModelGenerator
+{
+    return ActivityModelGeneratorWithDerivs{ model, derivs };
+}
+
+auto activityDerivsModel(ActivityModelGenerator const& model) -> ActivityDerivsModelGenerator
+{
+    auto const* target = model.target<ActivityModelGeneratorWithDerivs>();
+    return target ? target->derivs : ActivityDerivsModelGenerator();
+}
 
 auto chain(Vec<ActivityModelGenerator> const& models) -> ActivityModelGenerator
 {
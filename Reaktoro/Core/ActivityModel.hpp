@@ -52,6 +52,65 @@ using ActivityModel = Model<ActivityProps(ActivityModelArgs)>;
 /// @param species The species in the phase.
 using ActivityModelGenerator = Fn<ActivityModel(SpeciesList const& species)>;
 
+/// The derivatives of the activities of the species in a phase computed analytically by an activity model.
+/// These are the derivatives of the natural log of the activities, `ln_a`, which
+/// enter the chemical potentials of the species. The derivatives of the activity
+/// coefficients, `ln_g`, differ from these only by the derivatives of the
+/// concentration terms (e.g., mole fractions or molalities) of the species.
+/// @see ActivityDerivsModel
+struct ActivityDerivs
+{
+    /// The flag indicating if the derivatives with respect to temperature and pressure need to be computed.
+    /// If false, an ActivityDerivsModel function can leave `ln_a_T` and `ln_a_P` empty
+    /// and skip their calculation (e.g., when only the derivatives with respect to
+    /// mole fractions are needed for the Hessian of the Gibbs energy).
+    bool compute_TP = true;
+
+    /// The derivatives of the ln activities of the species with respect to temperature at constant pressure and mole fractions (in 1/K).
+    ArrayXd ln_a_T;
+
+    /// The derivatives of the ln activities of the species with respect to pressure at constant temperature and mole fractions (in 1/Pa).
+    ArrayXd ln_a_P;
+
+    /// The derivatives of the ln activities of the species with respect to their mole fractions at constant temperature and pressure.
+    /// The entry at row *i* and column *j* is the partial derivative of `ln_a[i]` with
+    /// respect to `x[j]` when every mole fraction in ActivityModelArgs is taken
+    /// as an independent variable (i.e., as when seeding `x[j]` for automatic
+    /// differentiation of the activity model).
+    MatrixXd ln_a_x;
+};
+
+/// The function type for the analytic calculation of the derivatives of the activities of the species in a phase.
+/// An activity model can optionally provide such function so that derivatives
+/// of the chemical potentials of the species (e.g., in the Hessian of the Gibbs
+/// energy in chemical equilibrium calculations) are computed without automatic
+/// differentiation of the activity model, which requires one evaluation of the
+/// model for each species. The derivatives must be consistent with the
+/// ActivityModel function from which they are derived.
+/// @see ActivityDerivs, ActivityModel
+using ActivityDerivsModel = Fn<void(ActivityDerivs& derivs, ActivityModelArgs args)>;
+
+/// The type for functions that construct an ActivityDerivsModel for a phase.
+/// @param species The species in the phase.
+using ActivityDerivsModelGenerator = Fn<ActivityDerivsModel(SpeciesList const& species)>;
+
+/// Return an activity model generator that also produces the analytic derivatives of the activity models it constructs.
+/// The returned object can be used wherever an ActivityModelGenerator is
+/// expected. The analytic derivatives can later be recovered with function
+/// @ref activityDerivsModel, which inspects the target of the returned
+/// std::function object. Thus, the derivative function is lost, and silently
+/// not used, if the returned generator is chained with other models, captured
+/// by or copied into another lambda or function object, or passed through the
+/// Python bindings. In these cases, attach the derivatives to the phase
+/// instead with Phase::withActivityDerivsModel.
+/// @param model The generator of the activity models.
+/// @param derivs The generator of the analytic derivatives of the activity models.
+auto withActivityDerivs(ActivityModelGenerator const& model, ActivityDerivsModelGenerator const& derivs) -> ActivityModelGenerator;
+
+/// Return the generator of analytic derivatives of the activity models produced by a given activity model generator.
+/// @return The ActivityDerivsModelGenerator object given to @ref withActivityDerivs, or an empty one if `model` was not created with it.
+auto activityDerivsModel(ActivityModelGenerator const& model) -> ActivityDerivsModelGenerator;
+
 /// Return an activity model resulting from chaining other activity models.
 auto chain(const Vec<ActivityModelGenerator>& models) -> ActivityModelGenerator;
 
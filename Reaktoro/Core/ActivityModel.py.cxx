@@ -37,6 +37,17 @@ void exportActivityModel(py::module& m)
     cls.def("__call__", [](const ActivityModel& self, const real& T, const real& P, ArrayXrConstRef x) { return self({T, P, x}); });
     cls.def("__call__", [](const ActivityModel& self, ActivityPropsRef props, const real& T, const real& P, ArrayXrConstRef x) { self(props, {T, P, x}); });
 
+    py::class_<ActivityDerivs>(m, "ActivityDerivs")
+        .def(py::init<>())
+        .def_readwrite("compute_TP", &ActivityDerivs::compute_TP)
+        .def_readwrite("ln_a_T", &ActivityDerivs::ln_a_T)
+        .def_readwrite("ln_a_P", &ActivityDerivs::ln_a_P)
+        .def_readwrite("ln_a_x", &ActivityDerivs::ln_a_x)
+        ;
+
+    m.def("withActivityDerivs", withActivityDerivs);
+    m.def("activityDerivsModel", activityDerivsModel);
+
     auto chain4py = [](py::args args)
     {
         Vec<ActivityModelGenerator> models;
@@ -27,11 +27,42 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return true if any of the given temperature, pressure and species amounts has a non-zero derivative seed.
+auto isSeeded(real const& T, real const& P, ArrayXrConstRef n) -> bool
+{
+    if(grad(T) != 0.0 || grad(P) != 0.0)
+        return true;
+    for(auto const& ni : n)
+        if(grad(ni) != 0.0)
+            return true;
+    return false;
+}
+
+/// Return true if the standard thermodynamic properties of the species, last evaluated at given stamp, are up-to-date for given temperature and pressure.
+/// This is never the case when memoization is disabled, since the parameters of the standard thermodynamic models may have changed since then.
+auto isStandardUpToDate(double Tstamp, double Pstamp, real const& T, real const& P) -> bool
+{
+    if(Memoization::isDisabled())
+        return false;
+    return grad(T) == 0.0 && grad(P) == 0.0 && T == Tstamp && P == Pstamp; // note: false when the stamp is NaN
+}
+
+/// Set to zero the derivative parts of the given real numbers.
+auto zeroDerivatives(ArrayXrRef a) -> void
+{
+    for(auto& ai : a)
+        autodiff::unseed(ai);
+}
+
+} // namespace
 
 ChemicalProps::ChemicalProps()
 {}
@@ -65,6 +96,8 @@ ChemicalProps::ChemicalProps(ChemicalSystem const& system)
     ln_a = ArrayXr::Zero(N);
     u    = ArrayXr::Zero(N);
     som.resize(K);
+    mphaseevaluated = ArrayXl::Zero(K);
+    mphasevalueonly = ArrayXl::Zero(K);
 }
 
 ChemicalProps::ChemicalProps(ChemicalState const& state)
@@ -89,6 +122,11 @@ auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -
     assert(P0 >= 0.0);
     assert(n0.size() == n.size() && (n0 >= 0.0).all());
 
+    // The properties of a phase can be reused if they were computed with the same conditions (and carry no derivatives)
+    const auto reusable = !Memoization::isDisabled() && T0 == T && P0 == P;
+
+    const auto standard = !isStandardUpToDate(mstandardT, mstandardP, T0, P0);
+
     T = T0;
     P = P0;
 
@@ -97,20 +135,41 @@ auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).update(T, P, np, m_extra);
+        const auto seeded = isSeeded(T0, P0, np);
+
+        // Skip the evaluation of the thermodynamic models of a phase whose conditions are unchanged (e.g., a pure mineral whose amount is
+        // pinned at its lower bound), unless its activity model depends on the state of other phases, which may have changed
+        const auto unchanged = reusable && mphasevalueonly[i] && !seeded && !detail::dependsOnOtherPhases(phase) && (np == n.segment(offset, size)).all();
+
+        if(!unchanged)
+            phasePropsRef(i).update(T, P, np, m_extra, standard);
+
+        mphaseevaluated[i] = 1;
+        mphasevalueonly[i] = !seeded;
         offset += size;
     }
+
+    // Stamp the standard thermodynamic properties with their conditions if they carry no derivatives
+    const auto seededTP = grad(T0) != 0.0 || grad(P0) != 0.0;
+    mstandardT = seededTP ? NaN : T0.val();
+    mstandardP = seededTP ? NaN : P0.val();
 }
 
 auto ChemicalProps::update(ArrayXrConstRef data) -> void
 {
     mstateid += 1;
+    mphaseevaluated.fill(0);
+    mphasevalueonly.fill(0);
+    mstandardT = mstandardP = NaN;
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::update(ArrayXdConstRef data) -> void
 {
     mstateid += 1;
+    mphaseevaluated.fill(0);
+    mphasevalueonly.fill(0);
+    mstandardT = mstandardP = NaN;
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
@@ -125,11 +184,15 @@ auto ChemicalProps::updateIdeal(ChemicalState const& state) -> void
 auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
     mstateid += 1;
+    mphaseevaluated.fill(0);
+    mphasevalueonly.fill(0);
 
     assert(T0 >= 0.0);
     assert(P0 >= 0.0);
     assert(n0.size() == n.size() && (n0 >= 0.0).all());
 
+    const auto standard = !isStandardUpToDate(mstandardT, mstandardP, T0, P0);
+
     T = T0;
     P = P0;
 
@@ -138,9 +201,59 @@ auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).updateIdeal(T, P, np, m_extra);
+        phasePropsRef(i).updateIdeal(T, P, np, m_extra, standard);
         offset += size;
     }
+
+    // Stamp the standard thermodynamic properties with their conditions if they carry no derivatives
+    const auto seededTP = grad(T0) != 0.0 || grad(P0) != 0.0;
+    mstandardT = seededTP ? NaN : T0.val();
+    mstandardP = seededTP ? NaN : P0.val();
+}
+
+auto ChemicalProps::updatePhase(Index iphase, ArrayXrConstRef np) -> void
+{
+    mstateid += 1;
+
+    assert(iphase < msystem.phases().size());
+    assert(np.size() == msystem.phase(iphase).species().size() && (np >= 0.0).all());
+
+    const auto standard = !isStandardUpToDate(mstandardT, mstandardP, T, P);
+
+    phasePropsRef(iphase).update(T, P, np, m_extra, standard);
+
+    mphaseevaluated[iphase] = 1;
+    mphasevalueonly[iphase] = !isSeeded(T, P, np);
+
+    if(standard)
+        mstandardT = mstandardP = NaN; // the standard properties of the other phases were not evaluated here
+}
+
+auto ChemicalProps::updatePhaseIdeal(Index iphase, ArrayXrConstRef np) -> void
+{
+    mstateid += 1;
+    mphaseevaluated[iphase] = 0;
+    mphasevalueonly[iphase] = 0;
+
+    assert(iphase < msystem.phases().size());
+    assert(np.size() == msystem.phase(iphase).species().size() && (np >= 0.0).all());
+
+    const auto standard = !isStandardUpToDate(mstandardT, mstandardP, T, P);
+
+    phasePropsRef(iphase).updateIdeal(T, P, np, m_extra, standard);
+
+    if(standard)
+        mstandardT = mstandardP = NaN; // the standard properties of the other phases were not evaluated here
+}
+
+auto ChemicalProps::clearDerivatives() -> void
+{
+    mstateid += 1;
+    mphasevalueonly = mphaseevaluated; // the values computed with update(T, P, n) are kept, now without derivatives
+    autodiff::unseed(T);
+    autodiff::unseed(P);
+    for(auto array : { &n, &Ts, &Ps, &nsum, &msum, &x, &G0, &H0, &V0, &VT0, &VP0, &Cp0, &Vx, &VxT, &VxP, &Vxi, &Gx, &Hx, &Cpx, &ln_g, &ln_a, &u })
+        zeroDerivatives(*array);
 }
 
 auto ChemicalProps::serialize(ArrayStream<real>& stream) const -> void
@@ -153,15 +266,46 @@ auto ChemicalProps::serialize(ArrayStream<double>& stream) const -> void
     stream.from(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
+auto ChemicalProps::serializedPhaseIndices() const -> ArrayXl
+{
+    const auto N = msystem.species().size();
+    const auto K = msystem.phases().size();
+
+    ArrayXl ispeciesphases(N); // the index of the phase of each species
+    for(auto i = 0; i < K; ++i)
+        ispeciesphases.segment(msystem.phases().numSpeciesUntilPhase(i), msystem.phase(i).species().size()).fill(i);
+
+    const ArrayXl iphases = ArrayXl::LinSpaced(K, 0, K - 1);
+
+    // The phase indices of the entries of an array with either one entry per species or one entry per phase
+    // (if N == K, there is one species per phase, and both choices coincide)
+    const auto indices = [&](ArrayXrConstRef array) -> ArrayXlConstRef { return array.size() == N ? ispeciesphases : iphases; };
+
+    const auto none = -1; // the phase index of temperature and pressure
+
+    ArrayXl res; // the phase indices in the same order as in serialize
+    ArraySerialization::resize(res, none, none, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+    ArraySerialization::serialize(res, none, none, indices(n), indices(Ts), indices(Ps), indices(nsum), indices(msum), indices(x), indices(G0), indices(H0), indices(V0), indices(VT0), indices(VP0),
+        indices(Cp0), indices(Vx), indices(VxT), indices(VxP), indices(Vxi), indices(Gx), indices(Hx), indices(Cpx), indices(ln_g), indices(ln_a), indices(u));
+
+    return res;
+}
+
 auto ChemicalProps::deserialize(const ArrayStream<real>& stream) -> void
 {
     mstateid += 1;
+    mphaseevaluated.fill(0);
+    mphasevalueonly.fill(0);
+    mstandardT = mstandardP = NaN;
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::deserialize(const ArrayStream<double>& stream) -> void
 {
     mstateid += 1;
+    mphaseevaluated.fill(0);
+    mphasevalueonly.fill(0);
+    mstandardT = mstandardP = NaN;
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
@@ -47,6 +48,21 @@ public:
     auto update(ChemicalState const& state) -> void;
 
     /// Update the chemical properties of the system.
+    /// If the given conditions of a phase (temperature, pressure and amounts
+    /// of its species) carry no derivative seeds and have the same values as
+    /// those of its last update, whose derivatives were either not seeded or
+    /// cleared with @ref clearDerivatives, the chemical properties of the
+    /// phase are already up-to-date and their evaluation is skipped. This is
+    /// the case of property queries on a chemical state that has just been
+    /// computed (e.g., by an equilibrium solver) and of phases whose species
+    /// are pinned at their lower bounds during an equilibrium calculation.
+    /// Phases whose activity models depend on the state of other phases (e.g.,
+    /// ion exchange phases) are always evaluated. The evaluation is never
+    /// skipped when memoization is disabled (see Memoization::disable), so
+    /// that changes in the parameters of the models are taken into account.
+    /// This is only a cache of the last evaluation: the properties that are
+    /// evaluated are always computed with type real, even when no derivatives
+    /// are needed, since the thermodynamic models are only available for it.
     /// @param T The temperature condition (in K)
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the system (in mol)
@@ -70,6 +86,26 @@ public:
     /// @param n The amounts of the species in the system (in mol)
     auto updateIdeal(real const& T, real const& P, ArrayXrConstRef n) -> void;
 
+    /// Update the chemical properties of a single phase, keeping those of all other phases unchanged.
+    /// Use this method when only the amounts of the species in the phase have
+    /// changed since the last update (e.g., to compute derivatives with respect
+    /// to the amount of a species, which affects only the properties of its phase).
+    /// @param iphase The index of the phase in the system
+    /// @param np The amounts of the species in the phase (in mol)
+    auto updatePhase(Index iphase, ArrayXrConstRef np) -> void;
+
+    /// Update the chemical properties of a single phase using its ideal activity model, keeping those of all other phases unchanged.
+    /// @param iphase The index of the phase in the system
+    /// @param np The amounts of the species in the phase (in mol)
+    auto updatePhaseIdeal(Index iphase, ArrayXrConstRef np) -> void;
+
+    /// Set to zero the derivatives stored in the chemical properties, keeping their values unchanged.
+    /// Use this method after the chemical properties have been evaluated with
+    /// seeded variables (e.g., in the computation of derivatives of a function
+    /// that depends on them) to obtain chemical properties that carry no
+    /// derivative information, without any temporary allocation.
+    auto clearDerivatives() -> void;
+
     /// Serialize the chemical properties into the array stream @p stream.
     /// @param stream The array stream used to serialize the chemical properties.
     auto serialize(ArrayStream<real>& stream) const -> void;
@@ -86,6 +122,10 @@ public:
     /// @param stream The array stream containing the serialized chemical properties.
     auto deserialize(const ArrayStream<double>& stream) -> void;
 
+    /// Return the index of the phase to which each entry of the serialized chemical properties belongs (see @ref serialize).
+    /// The entries that belong to no phase (i.e., temperature and pressure of the system) have index -1.
+    auto serializedPhaseIndices() const -> ArrayXl;
+
     /// Return the state identification number of this ChemicalProps object.
     /// Each time this ChemicalProps object is updated, its state identification
     /// number (`stateid`) is incremented. This is useful for memorizing
@@ -479,6 +519,18 @@ private:
     /// The state identification number of this ChemicalProps object.
     Index mstateid = 0;
 
+    /// The flags indicating the chemical properties of each phase were last evaluated with its activity model (not the ideal one) at the current conditions, with or without derivative seeds.
+    ArrayXl mphaseevaluated;
+
+    /// The flags indicating the chemical properties of each phase were last evaluated as in `mphaseevaluated` and carry no derivatives (i.e., no derivative seeds were used or they were cleared with @ref clearDerivatives).
+    ArrayXl mphasevalueonly;
+
+    /// The temperature (in K) at which the standard thermodynamic properties of the species were last evaluated without derivative seeds (NaN if they need to be evaluated again).
+    double mstandardT = NaN;
+
+    /// The pressure (in Pa) at which the standard thermodynamic properties of the species were last evaluated without derivative seeds (NaN if they need to be evaluated again).
+    double mstandardP = NaN;
+
     /// The ChemicalSystem object associated with this ChemicalProps object.
     ChemicalSystem msystem;
 
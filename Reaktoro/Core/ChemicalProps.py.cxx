@@ -36,6 +36,9 @@ void exportChemicalProps(py::module& m)
         .def("update", py::overload_cast<ArrayXdConstRef>(&ChemicalProps::update), "Update the chemical properties of the system with serialized data.")
         .def("updateIdeal", py::overload_cast<ChemicalState const&>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
         .def("updateIdeal", py::overload_cast<real const&, real const&, ArrayXrConstRef>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
+        .def("updatePhase", &ChemicalProps::updatePhase, "Update the chemical properties of a single phase, keeping those of all other phases unchanged.")
+        .def("updatePhaseIdeal", &ChemicalProps::updatePhaseIdeal, "Update the chemical properties of a single phase using its ideal activity model, keeping those of all other phases unchanged.")
+        .def("clearDerivatives", &ChemicalProps::clearDerivatives, "Set to zero the derivatives stored in the chemical properties, keeping their values unchanged.")
         .def("stateid", &ChemicalProps::stateid, "Return the state identification number of this ChemicalProps object")
         .def("system", &ChemicalProps::system, return_internal_ref, "Return the chemical system associated with these chemical properties.")
         .def("phaseProps", &ChemicalProps::phaseProps, py::keep_alive<0, 1>(), "Return the chemical properties of a phase with given index.")
@@ -21,6 +21,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 using namespace Reaktoro;
@@ -645,6 +646,284 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         CHECK( props.indicesPhasesWithSolidState() == Indices{1} );
     }
 
+    SECTION("Testing update of the chemical properties of a single phase")
+    {
+        const real T = 345.6;
+        const real P = 1.234e5;
+
+        ArrayXr n = ArrayXr{{ 0.1, 0.2, 0.3 }};
+
+        props.update(T, P, n);
+
+        n[0] = 0.5; // change only the amount of a species in the gaseous phase
+
+        ChemicalProps expected(system);
+        expected.update(T, P, n);
+
+        props.updatePhase(0, n.head(2));
+
+        CHECK( props.speciesAmounts().isApprox(expected.speciesAmounts()) );
+        CHECK( props.speciesActivitiesLn().isApprox(expected.speciesActivitiesLn()) );
+        CHECK( props.phaseProps(0).amount() == Approx(expected.phaseProps(0).amount()) );
+        CHECK( props.phaseProps(1).amount() == Approx(expected.phaseProps(1).amount()) );
+
+        autodiff::seed(n[1]);
+        props.updatePhase(0, n.head(2));
+        autodiff::unseed(n[1]);
+
+        CHECK( grad(props.phaseProps(0).amount()) == 1.0 ); // the gaseous phase depends on n[1]
+        CHECK( grad(props.phaseProps(1).amount()) == 0.0 ); // the solid phase was not updated
+
+        props.updatePhaseIdeal(1, n.tail(1));
+
+        CHECK( props.speciesAmounts().isApprox(expected.speciesAmounts()) );
+    }
+
+    SECTION("Testing update with unchanged conditions and without derivative seeds")
+    {
+        auto counter = 0; // the number of evaluations of the activity model below
+
+        ActivityModel activity_model_counted = [&](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            counter += 1;
+            activity_model_gas(props, args);
+        };
+
+        Phase phase = Phase()
+            .withName("SomeGas")
+            .withActivityModel(activity_model_counted)
+            .withIdealActivityModel(activity_model_gas)
+            .withStateOfMatter(StateOfMatter::Gas)
+            .withSpecies({
+                db.species().get("H2O(g)"),
+                db.species().get("CO2(g)")});
+
+        ChemicalSystem system(db, Vec<Phase>{ phase });
+
+        ChemicalProps props(system);
+
+        real T = 345.6;
+        real P = 1.234e5;
+
+        ArrayXr n = ArrayXr{{ 0.1, 0.2 }};
+
+        props.update(T, P, n);
+        CHECK( counter == 1 );
+
+        const ArrayXr u = props.speciesChemicalPotentials();
+
+        props.update(T, P, n); // the evaluation of the models is skipped here
+        CHECK( counter == 1 );
+        CHECK( (props.speciesChemicalPotentials() == u).all() );
+
+        autodiff::seed(T);
+        props.update(T, P, n); // the evaluation cannot be skipped when there are derivative seeds
+        autodiff::unseed(T);
+        CHECK( counter == 2 );
+        CHECK( grad(props.temperature()) == 1.0 );
+
+        props.update(T, P, n); // the derivatives computed in the last update must not be kept
+        CHECK( counter == 3 );
+        CHECK( grad(props.temperature()) == 0.0 );
+        CHECK( (props.speciesChemicalPotentials() == u).all() );
+
+        autodiff::seed(n[0]);
+        props.update(T, P, n);
+        autodiff::unseed(n[0]);
+        CHECK( counter == 4 );
+
+        props.clearDerivatives(); // as done by EquilibriumSolver once a calculation is over
+        props.update(T, P, n); // the evaluation of the models is skipped since the properties carry no derivatives now
+        CHECK( counter == 4 );
+        CHECK( (props.speciesChemicalPotentials() == u).all() );
+
+        props.updateIdeal(T, P, n);
+        props.clearDerivatives();
+        props.update(T, P, n); // the evaluation cannot be skipped after an update with ideal activity models
+        CHECK( counter == 5 );
+
+        n[0] = 0.3;
+        props.update(T, P, n);
+        CHECK( counter == 6 );
+
+        Memoization::disable();
+        props.update(T, P, n); // the evaluation cannot be skipped when memoization is disabled (e.g., after a change in model parameters)
+        Memoization::enable();
+        CHECK( counter == 7 );
+    }
+
+    SECTION("Testing update of only the phases whose conditions have changed")
+    {
+        auto counter_gas = 0;   // the number of evaluations of the activity model of the gaseous phase below
+        auto counter_solid = 0; // the number of evaluations of the activity model of the solid phase below
+
+        ActivityModel activity_model_gas_counted = [&](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            counter_gas += 1;
+            activity_model_gas(props, args);
+        };
+
+        ActivityModel activity_model_solid_counted = [&](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            counter_solid += 1;
+            activity_model_solid(props, args);
+        };
+
+        Vec<Phase> cphases
+        {
+            phases[0].withActivityModel(activity_model_gas_counted),
+            phases[1].withActivityModel(activity_model_solid_counted)
+        };
+
+        ChemicalSystem system(db, cphases);
+
+        ChemicalProps props(system);
+        ChemicalProps expected(system);
+
+        real T = 345.6;
+        real P = 1.234e5;
+
+        ArrayXr n = ArrayXr{{ 0.1, 0.2, 0.3 }};
+
+        props.update(T, P, n);
+        CHECK( counter_gas == 1 );
+        CHECK( counter_solid == 1 );
+
+        autodiff::seed(T);
+        props.update(T, P, n); // all phases depend on temperature
+        autodiff::unseed(T);
+        CHECK( counter_gas == 2 );
+        CHECK( counter_solid == 2 );
+
+        props.clearDerivatives(); // the last arguments of the memoized activity models still carry derivatives wrt T
+
+        n[0] = 0.4;
+        props.update(T, P, n); // only the amounts of the species in the gaseous phase have changed
+        CHECK( counter_gas == 3 );
+        CHECK( counter_solid == 2 ); // not evaluated although its memoized activity model would have been
+
+        expected.update(T, P, n);
+        CHECK( (props.speciesChemicalPotentials() == expected.speciesChemicalPotentials()).all() );
+
+        autodiff::seed(n[0]);
+        props.update(T, P, n); // the solid phase does not depend on n[0]
+        autodiff::unseed(n[0]);
+        CHECK( counter_gas == 4 );
+        CHECK( counter_solid == 2 );
+        CHECK( grad(props.speciesChemicalPotentials()[2]) == 0.0 );
+
+        props.update(T, P, n); // the derivatives in the gaseous phase must not be kept
+        CHECK( counter_gas == 5 );
+        CHECK( counter_solid == 2 );
+        CHECK( grad(props.speciesChemicalPotentials()).cwiseAbs().maxCoeff() == 0.0 );
+
+        T = 350.0;
+        props.update(T, P, n); // all phases depend on temperature
+        CHECK( counter_gas == 6 );
+        CHECK( counter_solid == 3 );
+    }
+
+    SECTION("Testing reuse of standard thermodynamic properties when temperature and pressure are unchanged")
+    {
+        auto counter = 0; // the number of evaluations of the standard thermodynamic model below
+
+        StandardThermoModel standard_thermo_model_counted = [&](real T, real P)
+        {
+            counter += 1;
+            return standard_thermo_model_gas(T, P);
+        };
+
+        Database db;
+        db.addSpecies( Species("H2O(g)").withStandardThermoModel(standard_thermo_model_counted) );
+        db.addSpecies( Species("CO2(g)").withStandardThermoModel(standard_thermo_model_counted) );
+
+        Phase phase = Phase()
+            .withName("SomeGas")
+            .withActivityModel(activity_model_gas)
+            .withIdealActivityModel(activity_model_gas)
+            .withStateOfMatter(StateOfMatter::Gas)
+            .withSpecies(db.species());
+
+        ChemicalSystem system(db, Vec<Phase>{ phase });
+
+        ChemicalProps props(system);
+
+        real T = 345.6;
+        real P = 1.234e5;
+
+        ArrayXr n = ArrayXr{{ 0.1, 0.2 }};
+
+        props.update(T, P, n);
+        CHECK( counter == 2 );
+
+        n[0] = 0.3;
+        props.update(T, P, n); // only the species amounts have changed
+        CHECK( counter == 2 );
+
+        props.updateIdeal(T, P, n);
+        CHECK( counter == 2 );
+
+        props.updatePhase(0, n);
+        CHECK( counter == 2 );
+
+        autodiff::seed(n[0]);
+        props.update(T, P, n); // the derivatives of the standard properties wrt species amounts are zero
+        autodiff::unseed(n[0]);
+        CHECK( counter == 2 );
+
+        autodiff::seed(T);
+        props.update(T, P, n);
+        autodiff::unseed(T);
+        CHECK( counter == 4 );
+        CHECK( grad(props.speciesStandardGibbsEnergies()).cwiseAbs().maxCoeff() > 0.0 );
+
+        props.update(T, P, n); // the standard properties with derivatives wrt temperature must not be reused
+        CHECK( counter == 6 );
+        CHECK( grad(props.speciesStandardGibbsEnergies()).cwiseAbs().maxCoeff() == 0.0 );
+
+        T = 350.0;
+        props.update(T, P, n);
+        CHECK( counter == 8 );
+        CHECK( props.speciesStandardGibbsEnergies()[0] == standard_thermo_model_gas(T, P).G0 );
+
+        props.update(VectorXr(props)); // the standard properties are unknown after an update with given data
+        props.update(T, P, n);
+        CHECK( counter == 10 );
+
+        Memoization::disable();
+        n[0] = 0.4;
+        props.update(T, P, n); // the standard properties are not reused when memoization is disabled (e.g., after a change in model parameters)
+        props.updatePhase(0, n);
+        Memoization::enable();
+        CHECK( counter == 14 );
+    }
+
+    SECTION("Testing clearing of derivatives in the chemical properties")
+    {
+        real T = 345.6;
+        real P = 1.234e5;
+
+        ArrayXr n = ArrayXr{{ 0.1, 0.2, 0.3 }};
+
+        props.update(T, P, n);
+
+        const ArrayXr u = props.speciesChemicalPotentials();
+
+        autodiff::seed(T);
+        props.update(T, P, n);
+        autodiff::unseed(T);
+
+        CHECK( grad(props.temperature()) == 1.0 );
+        CHECK( grad(props.speciesChemicalPotentials()).cwiseAbs().maxCoeff() > 0.0 );
+
+        props.clearDerivatives();
+
+        CHECK( grad(props.temperature()) == 0.0 );
+        CHECK( grad(props.speciesChemicalPotentials()).cwiseAbs().maxCoeff() == 0.0 );
+        CHECK( grad(VectorXr(props)).cwiseAbs().maxCoeff() == 0.0 );
+        CHECK( props.speciesChemicalPotentials().isApprox(u) );
+    }
+
     SECTION("Testing correct increment of state id as a ChemicalProps object is updated")
     {
         ChemicalState state(system);
@@ -703,5 +982,17 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         props.serialize(dstream);
         props.deserialize(dstream);
         CHECK(props.stateid() == 9);
+
+        // Checking stateid with ChemicalProps::updatePhase(iphase, np) method
+        props.updatePhase(0, n.head(2));
+        CHECK(props.stateid() == 10);
+
+        // Checking stateid with ChemicalProps::updatePhaseIdeal(iphase, np) method
+        props.updatePhaseIdeal(1, n.tail(1));
+        CHECK(props.stateid() == 11);
+
+        // Checking stateid with ChemicalProps::clearDerivatives() method
+        props.clearDerivatives();
+        CHECK(props.stateid() == 12);
     }
 }
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
@@ -216,9 +217,10 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param standard The flag indicating the standard thermodynamic properties of the species need to be evaluated (otherwise they are assumed up-to-date for given @p T and @p P)
+    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard = true)
     {
-        _update<false>(T, P, n, extra);
+        _update<false>(T, P, n, extra, standard);
     }
 
     /// Update the chemical properties of the phase using ideal activity models.
@@ -226,9 +228,10 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param standard The flag indicating the standard thermodynamic properties of the species need to be evaluated (otherwise they are assumed up-to-date for given @p T and @p P)
+    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard = true)
     {
-        _update<true>(T, P, n, extra);
+        _update<true>(T, P, n, extra, standard);
     }
 
     /// Update the chemical properties of the phase with given data.
@@ -657,9 +660,12 @@ private:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
+    /// @param standard The flag indicating the standard thermodynamic properties of the species need to be evaluated
     template<bool use_ideal_activity_model>
-    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard)
     {
+        REAKTORO_PROFILE_SCOPE("ChemicalPropsPhase::update");
+
         mdata.T = T;
         mdata.P = P;
         mdata.n = n;
@@ -702,17 +708,21 @@ private:
         assert(    u.size() == N );
         assert(   Vxi.size() == N );
 
-        // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
+        // Compute the standard thermodynamic properties of the species in the phase (if not up-to-date).
+        if(standard)
         {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
+            REAKTORO_PROFILE_SCOPE("StandardThermoModel");
+            StandardThermoProps aux;
+            for(auto i = 0; i < N; ++i)
+            {
+                aux = species[i].standardThermoProps(T, P);
+                G0[i]  = aux.G0;
+                H0[i]  = aux.H0;
+                V0[i]  = aux.V0;
+                VT0[i] = aux.VT0;
+                VP0[i] = aux.VP0;
+                Cp0[i] = aux.Cp0;
+            }
         }
 
         // Compute the amount of the phase
@@ -737,7 +747,11 @@ private:
             phase().idealActivityModel() : phase().activityModel();
 
         if(nsum == 0.0) aprops = 0.0;
-        else activity_model(aprops, args);
+        else
+        {
+            REAKTORO_PROFILE_SCOPE_NAMED_AT_RUNTIME("ActivityModel(" + phase().name() + ")");
+            activity_model(aprops, args);
+        }
 
         // Compute the chemical potentials of the species
         u = G0 + R*T*ln_a;
@@ -95,13 +95,13 @@ void exportChemicalPropsPhase(py::module& m)
 {
     createTemplateClassForChemicalPropsPhaseType<ChemicalPropsPhase>(m, "ChemicalPropsPhase")
         .def(py::init<const Phase&>())
-        .def("update", &ChemicalPropsPhase::update, "Update the chemical properties of the phase.")
-        .def("updateIdeal", &ChemicalPropsPhase::updateIdeal, "Update the chemical properties of the phase using ideal activity models.")
+        .def("update", &ChemicalPropsPhase::update, "Update the chemical properties of the phase.", py::arg("T"), py::arg("P"), py::arg("n"), py::arg("extra"), py::arg("standard") = true)
+        .def("updateIdeal", &ChemicalPropsPhase::updateIdeal, "Update the chemical properties of the phase using ideal activity models.", py::arg("T"), py::arg("P"), py::arg("n"), py::arg("extra"), py::arg("standard") = true)
         ;
 
     createTemplateClassForChemicalPropsPhaseType<ChemicalPropsPhaseRef>(m, "ChemicalPropsPhaseRef")
-        .def("update", &ChemicalPropsPhaseRef::update, "Update the chemical properties of the phase.")
-        .def("updateIdeal", &ChemicalPropsPhaseRef::updateIdeal, "Update the chemical properties of the phase using ideal activity models.")
+        .def("update", &ChemicalPropsPhaseRef::update, "Update the chemical properties of the phase.", py::arg("T"), py::arg("P"), py::arg("n"), py::arg("extra"), py::arg("standard") = true)
+        .def("updateIdeal", &ChemicalPropsPhaseRef::updateIdeal, "Update the chemical properties of the phase using ideal activity models.", py::arg("T"), py::arg("P"), py::arg("n"), py::arg("extra"), py::arg("standard") = true)
         ;
 
     createTemplateClassForChemicalPropsPhaseType<ChemicalPropsPhaseConstRef>(m, "ChemicalPropsPhaseConstRef")
@@ -18,6 +18,7 @@
 #include "ChemicalSystem.hpp"
 
 // C++ includes
+#include <atomic>
 #include <iostream>
 
 // Reaktoro includes
@@ -30,7 +31,7 @@ namespace detail {
 
 auto computeChemicalSystemID() -> Index
 {
-    static thread_local Index counter = 0;
+    static std::atomic<Index> counter{0}; // global (not thread_local) so that systems created in different threads never share an id (e.g., ids are used as keys in per-thread caches)
     return counter++;
 }
 
@@ -58,6 +58,9 @@ struct Phase::Impl
     /// The ideal activity model function of the phase.
     ActivityModel ideal_activity_model;
 
+    /// The function for the analytic derivatives of the activity model of the phase (empty if not available).
+    ActivityDerivsModel activity_derivs_model;
+
     /// The molar masses of the species in the phase.
     ArrayXd species_molar_masses;
 };
@@ -101,6 +104,7 @@ auto Phase::withActivityModel(const ActivityModel& model) -> Phase
 {
     Phase copy = clone();
     copy.pimpl->activity_model = model.withMemoization();
+    copy.pimpl->activity_derivs_model = {}; // any existing analytic derivatives are no longer consistent with the new activity model
     return copy;
 }
 
@@ -111,6 +115,13 @@ auto Phase::withIdealActivityModel(const ActivityModel& model) -> Phase
     return copy;
 }
 
+auto Phase::withActivityDerivsModel(const ActivityDerivsModel& model) -> Phase
+{
+    Phase copy = clone();
+    copy.pimpl->activity_derivs_model = model;
+    return copy;
+}
+
 auto Phase::name() const -> String
 {
     return pimpl->name;
@@ -161,6 +172,11 @@ auto Phase::idealActivityModel() const -> const ActivityModel&
     return pimpl->ideal_activity_model;
 }
 
+auto Phase::activityDerivsModel() const -> const ActivityDerivsModel&
+{
+    return pimpl->activity_derivs_model;
+}
+
 auto operator<(const Phase& lhs, const Phase& rhs) -> bool
 {
     return lhs.name() < rhs.name();
@@ -53,6 +53,10 @@ public:
     /// Return a copy of this Phase object with a new ideal activity model function.
     auto withIdealActivityModel(const ActivityModel& model) -> Phase;
 
+    /// Return a copy of this Phase object with a new function for the analytic derivatives of its activity model.
+    /// This function must be consistent with the activity model function of the phase and it should thus be set after it.
+    auto withActivityDerivsModel(const ActivityDerivsModel& model) -> Phase;
+
     /// Return the name of the phase.
     auto name() const -> String;
 
@@ -83,6 +87,9 @@ public:
     /// Return the function that computes ideal activity properties of the phase.
     auto idealActivityModel() const -> const ActivityModel&;
 
+    /// Return the function that computes the analytic derivatives of the activities of the species in the phase (empty if not available).
+    auto activityDerivsModel() const -> const ActivityDerivsModel&;
+
 private:
     struct Impl;
 
@@ -32,6 +32,7 @@ void exportPhase(py::module& m)
         .def("withStateOfMatter", &Phase::withStateOfMatter)
         .def("withActivityModel", &Phase::withActivityModel)
         .def("withIdealActivityModel", &Phase::withIdealActivityModel)
+        .def("withActivityDerivsModel", &Phase::withActivityDerivsModel)
         .def("name", &Phase::name)
         .def("stateOfMatter", &Phase::stateOfMatter)
         .def("aggregateState", &Phase::aggregateState)
@@ -42,5 +43,6 @@ void exportPhase(py::module& m)
         .def("speciesMolarMasses", &Phase::speciesMolarMasses, return_internal_ref)
         .def("activityModel", &Phase::activityModel, return_internal_ref)
         .def("idealActivityModel", &Phase::idealActivityModel, return_internal_ref)
+        .def("activityDerivsModel", &Phase::activityDerivsModel)
         ;
 }
@@ -191,6 +191,9 @@ auto GeneralPhase::convert(const Database& db, const Strings& elements) const ->
     phase = phase.withActivityModel(activity_model(species));
     phase = phase.withIdealActivityModel(ideal_activity_model(species));
 
+    if(auto const activity_derivs_model = activityDerivsModel(activity_model))
+        phase = phase.withActivityDerivsModel(activity_derivs_model(species));
+
     return phase;
 }
 
@@ -436,5 +436,14 @@ auto createSurfacesForReactingPhaseInterfacesInReactions(const Vec<Reaction>& re
     return vectorize(pairs, RKT_LAMBDA(x, createSurface(x.first, x.second)));
 }
 
+//=================================================================================================
+// AUXILIARY METHODS RELATED TO DEPENDENCIES AMONG PHASES
+//=================================================================================================
+
+auto dependsOnOtherPhases(Phase const& phase) -> bool
+{
+    return phase.aggregateState() == AggregateState::IonExchange;
+}
+
 } // namespace detail
 } // namespace Reaktoro
@@ -198,5 +198,14 @@ auto determineReactingPhaseInterfacesInReactions(Vec<Reaction> const& reactions,
 /// Return the phase interfaces, as phase index pairs, across which reactions take place.
 auto createSurfacesForReactingPhaseInterfacesInReactions(Vec<Reaction> const& reactions, PhaseList const& phases) -> Vec<Surface>;
 
+//=================================================================================================
+// AUXILIARY METHODS RELATED TO DEPENDENCIES AMONG PHASES
+//=================================================================================================
+
+/// Return true if the activity model of a phase depends on the state of other phases.
+/// This is the case of ion exchange phases, whose activity models use the ionic strength, density and
+/// dielectric constant of the aqueous phase stored in ChemicalProps::extra (see ActivityModelIonExchange).
+auto dependsOnOtherPhases(Phase const& phase) -> bool;
+
 } // namespace detail
 } // namespace Reaktoro
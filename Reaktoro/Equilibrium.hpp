@@ -26,7 +26,9 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumUtils.hpp>
+#include <Reaktoro/Equilibrium/ParallelEquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
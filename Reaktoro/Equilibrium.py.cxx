@@ -26,6 +26,7 @@ void exportEquilibriumResult(py::module& m);
 void exportEquilibriumSensitivity(py::module& m);
 void exportEquilibriumSolver(py::module& m);
 void exportEquilibriumSpecs(py::module& m);
+void exportEquilibriumTrace(py::module& m);
 void exportEquilibriumUtils(py::module& m);
 void exportSmartEquilibriumOptions(py::module& m);
 void exportSmartEquilibriumResult(py::module& m);
@@ -41,6 +42,7 @@ void exportEquilibrium(py::module& m)
     exportEquilibriumSensitivity(m);
     exportEquilibriumSolver(m);
     exportEquilibriumSpecs(m);
+    exportEquilibriumTrace(m);
     exportEquilibriumUtils(m);
     exportSmartEquilibriumOptions(m);
     exportSmartEquilibriumResult(m);
@@ -401,8 +401,17 @@ auto EquilibriumConditions::inputValues() const -> ArrayXrConstRef
 
 auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0) const -> ArrayXr
 {
+    ArrayXr wvals(w.size());
+    inputValuesGetOrCompute(state0, wvals.matrix());
+    return wvals;
+}
+
+auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0, VectorXrRef wvals) const -> void
+{
+    errorif(wvals.size() != w.size(), "Expecting in EquilibriumConditions::inputValuesGetOrCompute a vector with same size as that of number of input variables, ", w.size(), ", but got instead a vector with size ", wvals.size(), ".");
+
     // The input values with nan replaced by appropriate values whenever possible
-    ArrayXr wvals(w);
+    wvals = w.matrix();
 
     // If temperature is input, but current value is nan, fetch it from state0
     if(itemperature_w < w.size() && std::isnan(w[itemperature_w].val()))
@@ -413,10 +422,8 @@ auto EquilibriumConditions::inputValuesGetOrCompute(ChemicalState const& state0)
         wvals[ipressure_w] = state0.pressure();
 
     // Ensure no other input values are left unspecified! Only temperature and pressure can be inferred at the moment.
-    for(auto const& [i, wval] : enumerate(wvals))
-        errorif(std::isnan(wval.val()), "You have not specified a value for input `", wvars[i], "` in the EquilibriumConditions object.");
-
-    return wvals;
+    for(auto i = 0; i < wvals.size(); ++i)
+        errorif(std::isnan(wvals[i].val()), "You have not specified a value for input `", wvars[i], "` in the EquilibriumConditions object.");
 }
 
 auto EquilibriumConditions::inputValue(String const& name) const -> real const&
@@ -467,6 +474,15 @@ auto EquilibriumConditions::initialComponentAmountsGetOrCompute(ChemicalState co
     return c0.rows() != 0 ? c0 : ArrayXd(C * n0);
 }
 
+auto EquilibriumConditions::initialComponentAmountsGetOrCompute(ChemicalState const& state0, VectorXdRef c0vals) const -> void
+{
+    errorif(c0vals.rows() != C.rows(), "Expecting in EquilibriumConditions::initialComponentAmountsGetOrCompute a vector with size ", C.rows(), " but given one has size ", c0vals.rows(), " instead.");
+    const VectorXdConstRef n0 = state0.speciesAmounts();
+    if(c0.rows() != 0)
+        c0vals = c0.matrix();
+    else c0vals.noalias() = C * n0;
+}
+
 //=================================================================================================
 //
 // MISCELLANEOUS METHODS
@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Options.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// The options for the description of the Hessian of the Gibbs energy function
@@ -36,6 +39,77 @@ enum class GibbsHessian
 
     /// The Hessian of the Gibbs energy function is a diagonal matrix approximation using ideal thermodynamic models.
     ApproxDiagonal,
+
+    /// The calculation mode of the Hessian of the Gibbs energy function is chosen during each calculation.
+    /// The calculation starts with `Approx`, switches to `PartiallyExact` when the
+    /// contraction rate of the steps indicates convergence has stalled (see
+    /// `EquilibriumOptions::hessian_adaptive_stall_rate`), and switches to `Exact`
+    /// for the final steps (see `EquilibriumOptions::hessian_adaptive_final_step`).
+    /// This way, near-ideal systems converge with cheap Hessian evaluations while
+    /// strongly non-ideal ones (e.g., brines) get exact columns when needed.
+    Adaptive,
+};
+
+/// The strategy used to retry an equilibrium calculation after the previous attempt has failed.
+/// The options not given here are the same as in the first attempt.
+struct EquilibriumFallback
+{
+    /// The calculation mode of the Hessian of the Gibbs energy function in this attempt.
+    Optional<GibbsHessian> hessian;
+
+    /// The value multiplied by `epsilon` to compute the logarithm barrier penalty parameter @eq{\tau} in this attempt.
+    Optional<double> logarithm_barrier_factor;
+
+    /// The number of initial iterations of this attempt performed with ideal activity models.
+    /// These iterations produce an initial guess for the remaining iterations,
+    /// which are performed with the activity models of the phases (unless
+    /// `use_ideal_activity_models` is true in the options of the solver).
+    Index ideal_iterations = 0;
+
+    /// The flag indicating if the fix-and-accept strategy of the backtrack search in the optimization solver is toggled in this attempt.
+    bool toggle_min_max_fix = true;
+
+    /// The maximum number of iterations in this attempt (zero means the same as in the first attempt).
+    Index maxiters = 0;
+
+    /// The flag indicating if this attempt restarts from the initial guess of the calculation.
+    /// Set this to false to continue from the last iterate of the previous
+    /// failed attempt and so preserve its progress (the initial guess is still
+    /// used if that iterate has non-finite values).
+    bool restart = true;
+};
+
+/// The options that restrict the sensitivity derivatives computed in equilibrium calculations.
+/// Each input variable *w* costs one automatic differentiation pass of the
+/// chemical properties, and the total derivatives of the chemical properties
+/// require dense matrix products with one column per input variable and
+/// component. Applications needing only some of these derivatives (e.g., a
+/// reactive transport simulation needing only the derivatives of the species
+/// amounts with respect to the amounts of the transported components) can skip
+/// the computation of the others.
+struct EquilibriumSensitivityOptions
+{
+    /// The names of the input variables *w* with respect to which sensitivity derivatives are computed (all if not given).
+    /// The derivatives with respect to the other input variables are zero.
+    Optional<Strings> inputs;
+
+    /// The indices of the conservative components *c* with respect to which the total derivatives of the chemical properties are computed (all if not given).
+    /// The derivatives of the chemical properties with respect to the other
+    /// components are zero. The derivatives of the species amounts and control
+    /// variables are computed with respect to all components, since these come at
+    /// negligible extra cost from the optimization solver.
+    Optional<Indices> components;
+
+    /// The flag indicating if the total derivatives of the chemical properties are computed (see EquilibriumSensitivity::dudw and EquilibriumSensitivity::dudc).
+    /// Set this to false to skip the collection of the derivatives of the
+    /// chemical properties during the calculation and the dense matrix products
+    /// needed for these total derivatives, which are then empty matrices. When
+    /// true, the derivatives with respect to the species amounts are recorded
+    /// while the exact columns of the Hessian of the Gibbs energy function are
+    /// computed, so that both are reused in the sensitivity calculation right
+    /// after the last Newton step (e.g., in the learning steps of
+    /// SmartEquilibriumSolver) instead of being computed again.
+    bool chemical_props = true;
 };
 
 /// The options for the equilibrium calculations
@@ -61,11 +135,131 @@ struct EquilibriumOptions
     /// all equilibrium algorithms.
     bool warmstart = true;
 
+    /// The maximum number of previous solutions kept by an equilibrium solver to warm-start calculations from cold chemical states.
+    /// When a chemical state without a previous equilibrium solution compatible
+    /// with the equilibrium solver is given (e.g., a cell in a transport
+    /// simulation re-initialized from a boundary state), the stored solution
+    /// whose temperature, pressure and amounts of conservative components are
+    /// the nearest to those of the new calculation is used as initial guess.
+    /// The least recently used solutions are discarded when this number is
+    /// exceeded. Set this to zero to disable this warm-start strategy.
+    Index warmstart_cache_size = 0;
+
+    /// The relative resolution used to discretize temperature, pressure and amounts of conservative components in the warm-start cache.
+    /// Solutions of calculations whose discretized conditions are equal are stored only once (the most recent one is kept).
+    double warmstart_cache_resolution = 1e-3;
+
     /// The flag indicating if ideal activity models should be used in the calculations.
     bool use_ideal_activity_models = false;
 
+    /// The flag indicating if calculations from cold chemical states start with a preconditioning stage using ideal activity models.
+    /// In this stage, the calculation is performed with ideal activity models
+    /// and a diagonal approximation of the Hessian of the Gibbs energy function,
+    /// which are cheap to evaluate. The calculation then continues with the
+    /// activity models of the phases from the result of this stage. This avoids
+    /// spending the early iterations, performed far from the solution, evaluating
+    /// expensive activity models (e.g., Pitzer). A chemical state is cold if it
+    /// has no previous equilibrium solution compatible with the equilibrium solver
+    /// and none was found in the warm-start cache.
+    bool ideal_preconditioning = false;
+
+    /// The maximum number of iterations in the preconditioning stage with ideal activity models.
+    Index ideal_preconditioning_maxiters = 20;
+
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The contraction rate of the steps above which convergence is considered stalled when the calculation mode of the Hessian is `GibbsHessian::Adaptive`.
+    /// The contraction rate is the ratio between the norms of the last and the
+    /// previous steps of the species amounts. A rate close to one indicates the
+    /// approximated Hessian is not accurate enough, in which case its columns
+    /// corresponding to the primary species become exact.
+    double hessian_adaptive_stall_rate = 0.5;
+
+    /// The norm of a step, relative to that of the species amounts, below which the final steps of a calculation are considered to be taken when the calculation mode of the Hessian is `GibbsHessian::Adaptive`.
+    /// The exact Hessian is used in these steps so that they converge quadratically.
+    double hessian_adaptive_final_step = 1e-4;
+
+    /// The flag indicating if the exact columns of the Hessian of the Gibbs energy function are computed phase by phase.
+    /// When the chemical potential of a species depends only on the amounts of
+    /// the species in the same phase, only the properties of its phase need to
+    /// be re-evaluated when computing the derivatives with respect to the
+    /// amount of a species, and the activity models of all other phases are
+    /// skipped. This is not the case for activity models that use the state of
+    /// another phase via `props.extra`, such as ActivityModelIonExchange, which
+    /// uses the ionic strength of the aqueous phase. For this reason, this
+    /// option is ignored when the chemical system contains an ion exchange
+    /// phase. Custom activity models with such dependencies require this option
+    /// to be false, which is the default.
+    bool hessian_phase_blocks = false;
+
+    /// The flag indicating if several exact columns of the Hessian of the Gibbs energy function are computed in a single pass.
+    /// When there are no *p* and *q* control variables (e.g., temperature and
+    /// pressure are given), the Hessian is block-diagonal with one block per
+    /// phase. The amounts of one species from each phase can then be seeded at
+    /// once, so that the number of automatic differentiation passes is the
+    /// number of species in the largest phase rather than in the system. The
+    /// blocks themselves are dense, since the mole fractions of the species in
+    /// a phase depend on the amounts of all of them. Thus, there is little gain
+    /// when a single phase (e.g., a large aqueous phase) contains most species
+    /// of the system, and none for a system with a single multi-species phase.
+    /// This requires `hessian_phase_blocks` to be true. The same passes also
+    /// provide the derivatives of the chemical properties with respect to the
+    /// species amounts when sensitivity derivatives are assembled (e.g., in the
+    /// learning steps of SmartEquilibriumSolver), one phase at a time.
+    bool hessian_column_compression = false;
+
+    /// The flag indicating if analytic derivatives of activity models are used for the exact columns of the Hessian of the Gibbs energy function.
+    /// For phases whose activity models provide analytic derivatives of the ln
+    /// activities of the species (see @ref withActivityDerivs), the blocks of
+    /// the Hessian corresponding to these phases are computed without automatic
+    /// differentiation passes. The other phases continue to use automatic
+    /// differentiation. Similarly to `hessian_column_compression`, this is
+    /// used only when there are no *p* and *q* control variables. Note that
+    /// the derivatives attached with @ref withActivityDerivs are recovered
+    /// from the target of the std::function object of the activity model
+    /// generator. If this generator is wrapped (e.g., chained, copied into
+    /// another lambda, or created from Python), the derivatives are not found
+    /// and the phase silently falls back to automatic differentiation, unless
+    /// they are set with Phase::withActivityDerivsModel.
+    bool hessian_analytic_activity_derivs = false;
+
+    /// The number of consecutive calculations in which a species must remain pinned at its lower bound to be considered inactive.
+    /// Large systems (e.g., with species selected from SUPCRT or ThermoFun
+    /// databases) often have many species that stay at their lower bounds during
+    /// a whole simulation. The columns of the Hessian of the Gibbs energy function
+    /// corresponding to inactive species are approximated instead of computed
+    /// with automatic differentiation (see EquilibriumSetup::setInactiveSpecies).
+    /// This only saves automatic differentiation passes when `hessian` is
+    /// GibbsHessian::Exact, since species pinned at their lower bounds are not
+    /// primary species and their columns are thus already approximated with
+    /// GibbsHessian::PartiallyExact. Independently of this option, the
+    /// thermodynamic models of a phase whose species amounts remain unchanged
+    /// (e.g., a pure mineral pinned at its lower bound) are not evaluated again
+    /// (see ChemicalProps::update). However, a multi-species phase with a
+    /// single active species is still fully evaluated, so the cost of a
+    /// calculation does not scale only with the number of active species. A
+    /// species is reactivated as soon as it becomes stable (i.e., leaves its
+    /// lower bound) at the end of a calculation. Set this to zero to disable
+    /// this strategy.
+    Index inactive_species_threshold = 0;
+
+    /// The maximum number of recent calculations whose performance data are recorded by an equilibrium solver.
+    /// The recorded data include the number of iterations and backtracking steps,
+    /// and the time spent evaluating chemical properties, assembling the Hessian
+    /// of the Gibbs energy function, and in the optimization solver (see
+    /// EquilibriumSolver::trace). Set this to zero to disable the recording.
+    Index trace_size = 0;
+
+    /// The ordered strategies used to retry an equilibrium calculation whose first attempt has failed.
+    /// The strategies are attempted one after the other until one succeeds. The
+    /// default strategy restarts the calculation with the fix-and-accept strategy
+    /// of the backtrack search toggled. Set this to an empty vector to disable
+    /// retries. See @ref EquilibriumResult::fallback for the successful strategy.
+    Vec<EquilibriumFallback> fallbacks = { EquilibriumFallback() };
+
+    /// The options that restrict the sensitivity derivatives computed in calculations with an EquilibriumSensitivity object.
+    EquilibriumSensitivityOptions sensitivity;
 };
 
 } // namespace Reaktoro
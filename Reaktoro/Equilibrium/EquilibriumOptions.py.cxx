@@ -24,11 +24,50 @@ using namespace Reaktoro;
 
 void exportEquilibriumOptions(py::module& m)
 {
+    py::enum_<GibbsHessian>(m, "GibbsHessian")
+        .value("Exact", GibbsHessian::Exact)
+        .value("PartiallyExact", GibbsHessian::PartiallyExact)
+        .value("Approx", GibbsHessian::Approx)
+        .value("ApproxDiagonal", GibbsHessian::ApproxDiagonal)
+        .value("Adaptive", GibbsHessian::Adaptive)
+        ;
+
+    py::class_<EquilibriumFallback>(m, "EquilibriumFallback")
+        .def(py::init<>())
+        .def_readwrite("hessian", &EquilibriumFallback::hessian)
+        .def_readwrite("logarithm_barrier_factor", &EquilibriumFallback::logarithm_barrier_factor)
+        .def_readwrite("ideal_iterations", &EquilibriumFallback::ideal_iterations)
+        .def_readwrite("toggle_min_max_fix", &EquilibriumFallback::toggle_min_max_fix)
+        .def_readwrite("maxiters", &EquilibriumFallback::maxiters)
+        .def_readwrite("restart", &EquilibriumFallback::restart)
+        ;
+
+    py::class_<EquilibriumSensitivityOptions>(m, "EquilibriumSensitivityOptions")
+        .def(py::init<>())
+        .def_readwrite("inputs", &EquilibriumSensitivityOptions::inputs)
+        .def_readwrite("components", &EquilibriumSensitivityOptions::components)
+        .def_readwrite("chemical_props", &EquilibriumSensitivityOptions::chemical_props)
+        ;
+
     py::class_<EquilibriumOptions>(m, "EquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("optima", &EquilibriumOptions::optima)
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("logarithm_barrier_factor", &EquilibriumOptions::logarithm_barrier_factor)
         .def_readwrite("use_ideal_activity_models", &EquilibriumOptions::use_ideal_activity_models)
+        .def_readwrite("ideal_preconditioning", &EquilibriumOptions::ideal_preconditioning)
+        .def_readwrite("ideal_preconditioning_maxiters", &EquilibriumOptions::ideal_preconditioning_maxiters)
+        .def_readwrite("hessian_phase_blocks", &EquilibriumOptions::hessian_phase_blocks)
+        .def_readwrite("hessian_column_compression", &EquilibriumOptions::hessian_column_compression)
+        .def_readwrite("hessian_analytic_activity_derivs", &EquilibriumOptions::hessian_analytic_activity_derivs)
+        .def_readwrite("warmstart_cache_size", &EquilibriumOptions::warmstart_cache_size)
+        .def_readwrite("warmstart_cache_resolution", &EquilibriumOptions::warmstart_cache_resolution)
+        .def_readwrite("hessian", &EquilibriumOptions::hessian)
+        .def_readwrite("hessian_adaptive_stall_rate", &EquilibriumOptions::hessian_adaptive_stall_rate)
+        .def_readwrite("hessian_adaptive_final_step", &EquilibriumOptions::hessian_adaptive_final_step)
+        .def_readwrite("inactive_species_threshold", &EquilibriumOptions::inactive_species_threshold)
+        .def_readwrite("trace_size", &EquilibriumOptions::trace_size)
+        .def_readwrite("fallbacks", &EquilibriumOptions::fallbacks)
+        .def_readwrite("sensitivity", &EquilibriumOptions::sensitivity)
         ;
 }
@@ -22,6 +22,7 @@
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
@@ -74,6 +75,9 @@ struct EquilibriumProps::Impl
     MatrixXd dudnpw;                   ///< The partial derivatives of the serialized chemical properties *u* with respect to *(n, p, w)*.
     ArrayStream<real> stream;          ///< The array stream used during serialize and deserialize of chemical properties.
     bool assemblying_jacobian = false; ///< The flag indicating if the full Jacobian matrix is been constructed.
+    bool recording_dudn = false;       ///< The flag indicating if the derivatives with respect to *n* are being recorded outside a full Jacobian construction.
+    ArrayXl iuphases;                  ///< The index of the phase to which each entry of the serialized chemical properties *u* belongs (-1 for temperature and pressure).
+    ArrayXl ispeciesphases;            ///< The index of the phase of each species.
 
     /// Construct an EquilibriumProps::Impl object.
     Impl(const EquilibriumSpecs& specs)
@@ -84,6 +88,13 @@ struct EquilibriumProps::Impl
         const auto Nu = stream.data().rows();
         const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
         dudnpw = zeros(Nu, Nnpw);
+
+        // Initialize the indices of the phases to which the entries of *u* and the species belong
+        auto const& phases = specs.system().phases();
+        iuphases = state.props().serializedPhaseIndices();
+        ispeciesphases.resize(dims.Nn);
+        for(auto i = 0; i < phases.size(); ++i)
+            ispeciesphases.segment(phases.numSpeciesUntilPhase(i), phases[i].species().size()).fill(i);
     }
 
     /// Update the chemical properties of the chemical system.
@@ -104,7 +115,32 @@ struct EquilibriumProps::Impl
         update(n, p, w, useIdealModel);
 
         // Collect the derivatives of the chemical properties wrt some seeded variable in n, p, w.
-        if(assemblying_jacobian && inpw != -1)  // inpw === -1 if seeded variable is some variable in q (the amounts of implicit titrants)
+        collectDerivatives(inpw);
+    }
+
+    /// Update the chemical properties of a single phase in the chemical system.
+    auto updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void
+    {
+        auto const& system = specs.system();
+        auto const offset = system.phases().numSpeciesUntilPhase(iphase);
+        auto const size = system.phase(iphase).species().size();
+        auto const np = n.segment(offset, size).array();
+
+        state.setSpeciesAmounts(n);
+
+        if(useIdealModel)
+            state.props().updatePhaseIdeal(iphase, np);
+        else state.props().updatePhase(iphase, np);
+
+        // Collect the derivatives of the chemical properties wrt some seeded variable in n.
+        collectDerivatives(inpw);
+    }
+
+    /// Collect the derivatives of the chemical properties wrt the seeded variable in (n, p, w) with index `inpw`.
+    auto collectDerivatives(long inpw) -> void
+    {
+        const auto recording = assemblying_jacobian || (recording_dudn && inpw < long(dims.Nn));
+        if(recording && inpw != -1)  // inpw === -1 if seeded variable is some variable in q (the amounts of implicit titrants)
         {
             const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
             assert(inpw < Nnpw);
@@ -116,6 +152,22 @@ struct EquilibriumProps::Impl
         }
     }
 
+    /// Collect the derivatives of the chemical properties wrt the amounts of species in distinct phases seeded at the same time.
+    auto collectDerivativesPhases(Indices const& ispecies) -> void
+    {
+        if(!assemblying_jacobian && !recording_dudn)
+            return;
+        state.props().serialize(stream);
+        const auto size = dudnpw.rows();
+        for(auto i : ispecies)
+        {
+            auto col = dudnpw.col(i);
+            const auto iphase = ispeciesphases[i];
+            for(auto j = 0; j < size; ++j)
+                col[j] = iuphases[j] == iphase ? grad(stream.data()[j]) : 0.0; // the other seeded phases do not depend on n[i]
+        }
+    }
+
     /// Return the partial derivatives *du/dn*.
     auto dudn() const -> MatrixXdConstRef
     {
@@ -162,10 +214,21 @@ auto EquilibriumProps::update(VectorXrConstRef n, VectorXrConstRef p, VectorXrCo
     pimpl->update(n, p, w, useIdealModel, inpw);
 }
 
-auto EquilibriumProps::assembleFullJacobianBegin() -> void
+auto EquilibriumProps::updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void
+{
+    pimpl->updatePhase(iphase, n, p, w, useIdealModel, inpw);
+}
+
+auto EquilibriumProps::collectDerivativesPhases(Indices const& ispecies) -> void
+{
+    pimpl->collectDerivativesPhases(ispecies);
+}
+
+auto EquilibriumProps::assembleFullJacobianBegin(bool keepdudn) -> void
 {
     pimpl->assemblying_jacobian = true;
-    pimpl->dudnpw.fill(0.0); // initialize with zeros to remove previous derivative values
+    const auto offset = keepdudn ? pimpl->dims.Nn : 0;
+    pimpl->dudnpw.rightCols(pimpl->dudnpw.cols() - offset).fill(0.0); // initialize with zeros to remove previous derivative values
 }
 
 auto EquilibriumProps::assembleFullJacobianEnd() -> void
@@ -173,6 +236,17 @@ auto EquilibriumProps::assembleFullJacobianEnd() -> void
     pimpl->assemblying_jacobian = false;
 }
 
+auto EquilibriumProps::recordJacobianGradNBegin() -> void
+{
+    pimpl->recording_dudn = true;
+    pimpl->dudnpw.leftCols(pimpl->dims.Nn).fill(0.0); // initialize with zeros to remove previous derivative values
+}
+
+auto EquilibriumProps::recordJacobianGradNEnd() -> void
+{
+    pimpl->recording_dudn = false;
+}
+
 auto EquilibriumProps::chemicalState() const -> const ChemicalState&
 {
     return pimpl->state;
@@ -69,6 +69,36 @@ public:
     /// @param inpw The index of the variable in (n, p, w) currently seeded for autodiff computation.
     auto update(VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void;
 
+    /// Update the chemical properties of a single phase, keeping those of all other phases unchanged.
+    /// This method assumes that the given *p* and *w* are the same used in
+    /// the last update and that only the amounts of the species in the phase
+    /// may have changed. As in the method above, the derivatives of the
+    /// chemical properties with respect to the seeded variable in `n` are
+    /// recorded if the full Jacobian matrix is being assembled. Note that
+    /// these derivatives are correct only if the properties of all other
+    /// phases were last updated with no seeded variable.
+    /// @param iphase The index of the phase in the system.
+    /// @param n The amounts of the species.
+    /// @param p The values of the *p* control variables (e.g., T, P, n[H+] in case U, V and pH are given).
+    /// @param w The input variables *w* in the chemical equilibrium problem (e.g., U, V, pH).
+    /// @param useIdealModel If true, ideal thermodynamic models are used for the phase.
+    /// @param inpw The index of the variable in (n, p, w) currently seeded for autodiff computation (-1 if none).
+    auto updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw = -1) -> void;
+
+    /// Collect the derivatives of the chemical properties with respect to the amounts of species in distinct phases seeded at the same time.
+    /// Use this method after the properties of these phases have been updated
+    /// with @ref updatePhase, one seeded species per phase (e.g., when several
+    /// columns of the Hessian of the Gibbs energy function are computed in a
+    /// single forward pass). The properties of a phase depend only on the
+    /// amounts of its species, so the derivatives with respect to each seeded
+    /// amount are those of the properties of its phase, and zero otherwise. As
+    /// in @ref updatePhase, these derivatives are recorded only if the full
+    /// Jacobian matrix is being assembled or @ref recordJacobianGradNBegin was
+    /// called. This is not valid for phases whose properties depend on the
+    /// state of other phases (e.g., ion exchange phases).
+    /// @param ispecies The indices of the seeded species (at most one per phase).
+    auto collectDerivativesPhases(Indices const& ispecies) -> void;
+
     /// Enable recording of derivatives of the chemical properties with respect
     /// to *(n, p, w)* to contruct its full Jacobian matrix.
     /// Consider a series of forward automatic differentiation passes to
@@ -80,13 +110,29 @@ public:
     /// @note Call @ref assembleFullJacobianEnd after these forward passes
     /// have ended to eliminates the minor overhead of recording derivatives.
     /// @note Access these derivatives with methods @ref dudn, @ref dudp, and @ref dudw.
-    auto assembleFullJacobianBegin() -> void;
+    /// @param keepdudn If true, the derivatives with respect to *n* recorded
+    /// last are kept (e.g., because they were recorded with @ref
+    /// recordJacobianGradNBegin at the current conditions and no forward pass
+    /// with respect to *n* follows).
+    auto assembleFullJacobianBegin(bool keepdudn = false) -> void;
 
     /// Disable recording of derivatives of the chemical properties with
     /// respect to *(n, p, w)* to indicate the end of the full Jacobian matrix
     /// construction.
     auto assembleFullJacobianEnd() -> void;
 
+    /// Enable recording of derivatives of the chemical properties with respect to *n* only.
+    /// Use this method before forward automatic differentiation passes with
+    /// respect to the species amounts performed outside a full Jacobian
+    /// construction (e.g., for the Hessian of the Gibbs energy function), so
+    /// that the derivatives in @ref dudn can be kept in a later full Jacobian
+    /// construction at the same conditions. The previous values in @ref dudn
+    /// are set to zero.
+    auto recordJacobianGradNBegin() -> void;
+
+    /// Disable recording of derivatives of the chemical properties with respect to *n* only.
+    auto recordJacobianGradNEnd() -> void;
+
     /// Return the underlying chemical state of the system and its updated properties.
     auto chemicalState() const -> const ChemicalState&;
 
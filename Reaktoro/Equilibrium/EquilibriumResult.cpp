@@ -22,6 +22,7 @@ namespace Reaktoro {
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optima += other.optima;
+    fallback = other.fallback;
     return *this;
 }
 
@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Result.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// A type used to describe the result of an equilibrium calculation
@@ -38,6 +41,11 @@ struct EquilibriumResult
     /// The result of the optimisation calculation using Optima.
     Optima::Result optima;
 
+    /// The number of the strategy in EquilibriumOptions::fallbacks that produced this result (zero if produced by the first attempt).
+    /// For example, a value of 2 means the first attempt and the first fallback
+    /// strategy failed, and this result comes from the second fallback strategy.
+    Index fallback = 0;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
@@ -30,5 +30,6 @@ void exportEquilibriumResult(py::module& m)
         .def("failed", &EquilibriumResult::failed, "Return true if the calculation failed.")
         .def("iterations", &EquilibriumResult::iterations, "Return the number of iterations in the calculation.")
         .def_readwrite("optima", &EquilibriumResult::optima)
+        .def_readwrite("fallback", &EquilibriumResult::fallback)
         ;
 }
@@ -17,10 +17,17 @@
 
 #include "EquilibriumSetup.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Core/ActivityModel.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -82,7 +89,27 @@ struct EquilibriumSetup::Impl
     MatrixXd Vpc;                             ///< The Jacobian of vp with respect to c = (w, b).
     ArrayXr mu;                               ///< The auxiliary vector of chemical potentials of the species.
     VectorXl isbasicvar;                      ///< The bitmap that indicates which variables in x = (n, q) are currently basic variables.
+    VectorXl isinactive;                      ///< The bitmap that indicates which species are currently inactive (pinned at their lower bounds, see @ref EquilibriumSetup::setInactiveSpecies).
     Indices ipps;                             ///< The indices of the pure phase species (i.e., species composing single-phase species, whose chemical potentials do not depend on composition)
+    Indices iphases;                          ///< The index of the phase containing each species.
+    Indices ioffsets;                         ///< The index of the first species of each phase (with an extra entry equal to the number of species).
+    bool coupledphases = false;               ///< The flag that indicates the activity model of a phase depends on the state of other phases (see detail::dependsOnOtherPhases).
+    Indices iwsensitivity;                    ///< The indices of the input variables w with respect to which derivatives are computed in @ref updateGradW.
+    Indices ispecies;                         ///< The indices of the species whose columns in Hxx are being computed (workspace sorted by phase).
+    Vec<Pair<Index, Index>> iblocks;          ///< The ranges in `ispecies` of the species in the same phase (workspace used when compressing columns of Hxx).
+    Indices iseeded;                          ///< The indices of the species currently seeded together (workspace used when compressing columns of Hxx).
+    ActivityDerivs activity_derivs;           ///< The analytic derivatives of the ln activities of the species in a phase (workspace used when computing columns of Hxx analytically).
+    VectorXd ln_a_xx;                         ///< The product of the derivatives of ln activities of the species in a phase with their mole fractions (workspace used when computing columns of Hxx analytically).
+    bool assembling_jacobian = false;         ///< The flag that indicates the derivatives of the chemical properties are being collected (one seeded variable per phase at a time required).
+    VectorXr xgradx;                          ///< The vector x = (n, q) at which Hxx and Vpx were last computed.
+    VectorXr pgradx;                          ///< The vector p at which Hxx and Vpx were last computed.
+    VectorXr wgradx;                          ///< The vector w at which Hxx and Vpx were last computed.
+    VectorXl ibasicgradx;                     ///< The indices of the basic variables with which Hxx and Vpx were last computed.
+    bool gradxvalid = false;                  ///< The flag that indicates Hxx and Vpx are valid for `xgradx`, `pgradx`, `wgradx` and `ibasicgradx` with current options, inactive species and calculation mode of Hxx.
+    bool gradxdudn = false;                   ///< The flag that indicates the derivatives of the chemical properties with respect to n were recorded when Hxx was last computed.
+    GibbsHessian hessianmode = GibbsHessian::PartiallyExact; ///< The calculation mode of Hxx in use (chosen at every step when `options.hessian` is GibbsHessian::Adaptive).
+    VectorXd nadaptive;                       ///< The amounts of the species in the last step in which Hxx was computed (used when `options.hessian` is GibbsHessian::Adaptive).
+    double stepadaptive = 0.0;                ///< The norm of the last step of the species amounts (used when `options.hessian` is GibbsHessian::Adaptive).
 
     // -------------------------------------------- //
     // ------ CONVENIENT AUXILIARY VARIABLES ------ //
@@ -136,38 +163,62 @@ struct EquilibriumSetup::Impl
         mu.resize(Nn);
 
         isbasicvar.resize(Nx);
+        isinactive = VectorXl::Zero(Nn);
+        iwsensitivity = range(Nw);
 
-        // Initialize the indices of the pure phase species
+        // Initialize the indices of the pure phase species and the indices of the phases containing each species
         auto offset = 0;
-        for(auto const& phase : system.phases())
+        for(auto const& [iphase, phase] : enumerate(system.phases()))
         {
             const auto size = phase.species().size();
             if(size == 1)
                 ipps.push_back(offset);
+            iphases.insert(iphases.end(), size, iphase);
+            ioffsets.push_back(offset);
             offset += size;
+            coupledphases = coupledphases || detail::dependsOnOtherPhases(phase);
         }
+        ioffsets.push_back(offset);
+
+        ispecies.reserve(Nn);
+        iblocks.reserve(system.phases().size());
+        iseeded.reserve(system.phases().size());
     }
 
     auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
     {
-        VectorXd xlower = constants(Nx, -inf);
+        VectorXd xlower(Nx);
+        assembleLowerBoundsVector(restrictions, state0, xlower);
+        return xlower;
+    }
+
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    {
+        VectorXd xupper(Nx);
+        assembleUpperBoundsVector(restrictions, state0, xupper);
+        return xupper;
+    }
+
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
+    {
+        assert(xlower.size() == Nx);
+        xlower.fill(-inf);
         auto nlower = xlower.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
         for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i]; // this comes after, in case a species cannot strictly decrease
         for(auto& val : nlower) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon. TODO: Issue a warning when lower/upper bound of a species amount is changed to EquilibriumOptions::epsilon.
-        return xlower;
     }
 
-    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
     {
-        VectorXd xupper = constants(Nx, inf);
+        assert(xupper.size() == Nx);
+        xupper.fill(inf);
         auto nupper = xupper.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
         for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i]; // this comes after, in case a species cannot strictly increase
         for(auto& val : nupper) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon.
-        return xupper;
     }
 
     auto update(VectorXrConstRef xx, VectorXrConstRef pp, VectorXrConstRef ww) -> void
@@ -188,6 +239,22 @@ struct EquilibriumSetup::Impl
 
     auto updateGradX(VectorXlConstRef ibasicvars) -> void
     {
+        REAKTORO_PROFILE_SCOPE("EquilibriumSetup::updateGradX");
+
+        // Skip the computation of Hxx and Vpx if they were last computed at the same point (e.g., when the
+        // optimization solver evaluates the sensitivity derivatives right after the last Newton step)
+        if(isGradXUpToDate(ibasicvars))
+            return;
+
+        updateHessianMode();
+
+        // Record the derivatives of the chemical properties with respect to n while computing the columns of Hxx, so that
+        // they can be reused with Hxx when the sensitivity derivatives are computed right after the last Newton step
+        gradxdudn = assembling_jacobian || (options.sensitivity.chemical_props && !usingAnalyticActivityDerivs(false));
+
+        if(gradxdudn)
+            props.recordJacobianGradNBegin();
+
         isbasicvar.fill(false);
         isbasicvar(ibasicvars).fill(true);
 
@@ -203,57 +270,367 @@ struct EquilibriumSetup::Impl
         {
             auto Hnn = Hxx.topLeftCorner(Nn, Nn);
 
-            if(options.hessian == GibbsHessian::ApproxDiagonal)
+            if(hessianmode == GibbsHessian::ApproxDiagonal)
             {
                 Hnn = hessian.diagonal(n);
                 add_log_barrier_contrib(Hnn);
             }
-            else if(options.hessian == GibbsHessian::Approx)
+            else if(hessianmode == GibbsHessian::Approx)
             {
                 Hnn = hessian.approximate(n);
                 add_log_barrier_contrib(Hnn);
             }
-            else if(options.hessian == GibbsHessian::PartiallyExact)
+            else if(hessianmode == GibbsHessian::PartiallyExact)
             {
                 Hnn = hessian.approximate(n);
                 add_log_barrier_contrib(Hnn);
 
-                // Update columns of Hxx and Vpx corresponding to primary species
+                // Update columns of Hxx corresponding to primary species
+                ispecies.clear();
                 for(auto i : ibasicvars)
-                {
-                    if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
-                    updateFx(i);
-                    Hxx.col(i) = grad(F.head(Nx));
-                }
+                    if(i < Nn) // skip i corresponding to a `q` variable, in which case the implicit titrant is currently a primary species
+                        ispecies.push_back(i);
+                std::sort(ispecies.begin(), ispecies.end()); // species of the same phase become contiguous
+                updateGradNInactive();
+                updateGradN(false);
             }
             else // case GibbsHessian::Exact
             {
-                // Update Hxx and Vpx columns for all species
-                for(auto i = 0; i < Nn; ++i)
-                {
-                    updateFx(i);
-                    Hxx.col(i) = grad(F.head(Nx));
-                    Vpx.col(i) = grad(F.tail(Np));
-                }
+                // Update Hxx and Vpx columns for all species (with approximate columns for inactive species)
+                ispecies.resize(Nn);
+                std::iota(ispecies.begin(), ispecies.end(), 0);
+                updateGradNInactive();
+                updateGradN(true);
             }
         }
         else // when there are p variables, some problems (e.g., those in NasaDatabase), need Vpx to be calculated; Vpx = 0  causes convergence failure
         {
-            // TODO: Implement ActivityModel as a class that also has methods to compute derivatives
-            // wrt temperature, pressure, mole fractions. By default, these methods should be
-            // computed using autodiff. They can be override, however, for more efficient
-            // computations (manually).
-            for(auto i = 0; i < Nn; ++i)
-            {
-                updateFx(i);
-                Hxx.col(i) = grad(F.head(Nx));
-                Vpx.col(i) = grad(F.tail(Np));
-            }
+            ispecies.resize(Nn);
+            std::iota(ispecies.begin(), ispecies.end(), 0);
+            updateGradN(true);
         }
 
         Hxx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
         Hxx.bottomRows(Nq).fill(0.0); // these are derivatives w.r.t. amounts of implicit titrants q
         Vpx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
+
+        if(gradxdudn)
+            props.recordJacobianGradNEnd();
+
+        xgradx = x;
+        pgradx = p;
+        wgradx = w;
+        ibasicgradx = ibasicvars;
+        gradxvalid = true;
+    }
+
+    /// Update the calculation mode of Hxx based on the contraction rate of the steps of the species amounts (if `options.hessian` is GibbsHessian::Adaptive).
+    /// The mode only moves towards more exact Hessian matrices during a calculation: from
+    /// Approx to PartiallyExact when convergence stalls, and to Exact in the final steps.
+    auto updateHessianMode() -> void
+    {
+        if(options.hessian != GibbsHessian::Adaptive)
+            return;
+
+        const VectorXd nval = n.cast<double>();
+
+        if(nadaptive.size() != Nn) // the first step of the calculation
+        {
+            nadaptive = nval;
+            stepadaptive = 0.0;
+            return;
+        }
+
+        const auto step = (nval - nadaptive).norm();
+        const auto rate = stepadaptive > 0.0 ? step / stepadaptive : 0.0;
+
+        nadaptive = nval;
+        stepadaptive = step;
+
+        if(step <= options.hessian_adaptive_final_step * nval.norm())
+            hessianmode = GibbsHessian::Exact;
+        else if(rate > options.hessian_adaptive_stall_rate && hessianmode == GibbsHessian::Approx)
+            hessianmode = GibbsHessian::PartiallyExact;
+    }
+
+    /// Restart the selection of the calculation mode of Hxx for a new calculation.
+    auto resetHessianMode() -> void
+    {
+        hessianmode = options.hessian == GibbsHessian::Adaptive ? GibbsHessian::Approx : options.hessian;
+        nadaptive.resize(0);
+        stepadaptive = 0.0;
+        gradxvalid = false; // Hxx may have been computed with another calculation mode
+    }
+
+    /// Return true if Hxx and Vpx were last computed at the current point (x, p, w).
+    auto isGradXPointUpToDate() const -> bool
+    {
+        return gradxvalid
+            && x.size() == xgradx.size() && x == xgradx
+            && p.size() == pgradx.size() && p == pgradx
+            && w.size() == wgradx.size() && w == wgradx;
+    }
+
+    /// Return true if Hxx and Vpx were last computed at the current point (x, p, w) with the same basic variables.
+    /// While the full Jacobian of the chemical properties is being assembled, this also requires
+    /// that its columns with respect to n were recorded when Hxx was last computed.
+    auto isGradXUpToDate(VectorXlConstRef ibasicvars) const -> bool
+    {
+        return isGradXPointUpToDate()
+            && (!assembling_jacobian || gradxdudn)
+            && ibasicvars.size() == ibasicgradx.size() && ibasicvars == ibasicgradx;
+    }
+
+    /// Update the columns of Hxx (and optionally Vpx) corresponding to the species in `ispecies` (sorted in ascending order).
+    /// If @ref usingPhaseBlocks is true, the amount of each species is seeded and only the properties of
+    /// its phase are re-evaluated, since the properties of the other phases do not depend on it. Once all
+    /// columns of species in a phase have been computed, the properties of this phase are re-evaluated
+    /// without seeded variables so that the phase does not contribute derivatives to columns of other phases.
+    auto updateGradN(bool updateVpx) -> void
+    {
+        if(usingAnalyticActivityDerivs(updateVpx))
+            updateGradNAnalytic(); // this removes from `ispecies` the species whose columns were computed
+
+        if(usingCompressedColumns(updateVpx))
+            return updateGradNCompressed();
+
+        const auto size = ispecies.size();
+
+        for(auto k = 0; k < size;)
+        {
+            const auto iphase = iphases[ispecies[k]];
+
+            const auto offset = ioffsets[iphase];
+            const auto length = ioffsets[iphase + 1] - offset;
+
+            for(; k < size && iphases[ispecies[k]] == iphase; ++k)
+            {
+                const auto i = ispecies[k];
+                if(usingBlockDiagonalDerivatives())
+                {
+                    updateFnPhase(iphase, i); // only the entries of F corresponding to the phase are updated here
+                    Hxx.col(i).fill(0.0);
+                    Hxx.col(i).segment(offset, length) = grad(F.segment(offset, length));
+                    continue;
+                }
+                if(usingPhaseBlocks())
+                    updateFnPhase(iphase, i);
+                else updateFn(i);
+                Hxx.col(i) = grad(F.head(Nx));
+                if(updateVpx)
+                    Vpx.col(i) = grad(F.tail(Np));
+            }
+
+            if(usingPhaseBlocks())
+                props.updatePhase(iphase, n, p, w, options.use_ideal_activity_models);
+        }
+    }
+
+    /// Update the columns of Hxx corresponding to the inactive species in `ispecies` using the diagonal approximation of the Hessian.
+    /// These species are removed from `ispecies`, so that no automatic differentiation pass is needed for them. Because
+    /// they remain pinned at their lower bounds, the optimization solver excludes them from its Newton steps, and the
+    /// approximation of their columns affects neither the solution nor the exact gradient used in their stability checks.
+    auto updateGradNInactive() -> void
+    {
+        if((isinactive.array() == 0).all())
+            return;
+
+        const auto tau = options.epsilon * options.logarithm_barrier_factor;
+
+        const auto Hdiag = hessian.diagonal(n);
+
+        auto kept = 0; // the number of species in `ispecies` whose columns still need to be computed
+
+        for(auto k = 0; k < ispecies.size(); ++k)
+        {
+            const auto i = ispecies[k];
+
+            if(!isinactive[i])
+            {
+                ispecies[kept++] = i;
+                continue;
+            }
+
+            const auto iphase = iphases[i];
+
+            Hxx.col(i).fill(0.0);
+            Hxx(i, i) = Hdiag(i, i);
+            if(ioffsets[iphase + 1] - ioffsets[iphase] == 1)
+                Hxx(i, i) += tau/(n[i].val() * n[i].val()); // the log-barrier contribution of a pure phase species (see updateF)
+        }
+
+        ispecies.resize(kept);
+    }
+
+    /// Return true if the exact columns of Hxx are computed phase by phase (see EquilibriumOptions::hessian_phase_blocks).
+    /// This is never the case if the activity model of a phase depends on the state of other phases (e.g., that of an
+    /// ion exchange phase depends on the aqueous phase), since re-evaluating only the phase of a seeded species would
+    /// then lose the derivatives of the chemical potentials of the species in the dependent phase.
+    auto usingPhaseBlocks() const -> bool
+    {
+        return options.hessian_phase_blocks
+            && !coupledphases;
+    }
+
+    /// Return true if Hxx is block-diagonal with one block per phase in the current calculation.
+    /// This happens when there are no *p* and *q* control variables, since the chemical potential of a species
+    /// then depends only on the amounts of the species in the same phase. The entries of Hxx outside these blocks
+    /// are zero, and only the entries of F corresponding to the phase of a seeded species need to be evaluated.
+    /// This only reduces the cost of assembling Hxx. The matrix given to the optimization solver remains
+    /// dense, and its factorization does not exploit this block structure.
+    auto usingBlockDiagonalDerivatives() const -> bool
+    {
+        return usingPhaseBlocks()
+            && Np == 0
+            && Nq == 0;
+    }
+
+    /// Return true if several columns of Hxx can be computed in a single pass in the current calculation.
+    /// This requires Hxx to be block-diagonal with one block per phase, which happens when there are
+    /// no *p* and *q* control variables. The derivatives of the chemical properties with respect to
+    /// the seeded species amounts, if being collected, are then recorded one phase at a time.
+    auto usingCompressedColumns(bool updateVpx) const -> bool
+    {
+        return options.hessian_column_compression
+            && usingPhaseBlocks()
+            && !updateVpx
+            && Np == 0
+            && Nq == 0;
+    }
+
+    /// Return true if the columns of Hxx can be computed with analytic derivatives of activity models in the current calculation.
+    /// Similarly to @ref usingCompressedColumns, this requires Hxx to be block-diagonal with one block per phase
+    /// (thus, not if the activity model of a phase depends on the state of other phases, see @ref usingPhaseBlocks).
+    auto usingAnalyticActivityDerivs(bool updateVpx) const -> bool
+    {
+        return options.hessian_analytic_activity_derivs
+            && !coupledphases
+            && !options.use_ideal_activity_models
+            && !updateVpx
+            && !assembling_jacobian
+            && Np == 0
+            && Nq == 0;
+    }
+
+    /// Update the columns of Hxx corresponding to the species in `ispecies` (sorted in ascending order) using analytic derivatives of activity models.
+    /// Only the phases whose activity models provide analytic derivatives are handled here. Their species are
+    /// removed from `ispecies`, so that the columns of the remaining species are computed with automatic differentiation.
+    /// The derivatives with respect to the mole fractions are converted into derivatives with respect to species amounts using
+    /// d(ln a[r])/dn[i] = (d(ln a[r])/dx[i] - sum(d(ln a[r])/dx[k] * x[k]))/nsum.
+    auto updateGradNAnalytic() -> void
+    {
+        auto const& cprops = props.chemicalProps();
+
+        const auto tau = options.epsilon * options.logarithm_barrier_factor;
+
+        const auto size = ispecies.size();
+
+        auto kept = 0; // the number of species in `ispecies` whose columns still need to be computed
+
+        for(auto k = 0; k < size;)
+        {
+            const auto start = k;
+            const auto iphase = iphases[ispecies[k]];
+            while(k < size && iphases[ispecies[k]] == iphase)
+                ++k;
+
+            auto const& derivsmodel = system.phase(iphase).activityDerivsModel();
+
+            const auto pprops = cprops.phaseProps(iphase);
+            const auto nsum = pprops.amount().val();
+
+            if(!derivsmodel || nsum == 0.0)
+            {
+                for(auto j = start; j < k; ++j)
+                    ispecies[kept++] = ispecies[j];
+                continue;
+            }
+
+            const auto T = pprops.temperature();
+            const auto P = pprops.pressure();
+            const auto x = pprops.speciesMoleFractions();
+
+            activity_derivs.compute_TP = false; // only the derivatives wrt the mole fractions enter the columns of Hxx
+
+            derivsmodel(activity_derivs, { T, P, x });
+
+            auto const& ln_a_x = activity_derivs.ln_a_x;
+
+            ln_a_xx.noalias() = ln_a_x * VectorXd(x.matrix());
+
+            const auto offset = ioffsets[iphase];
+            const auto length = ioffsets[iphase + 1] - offset;
+
+            for(auto j = start; j < k; ++j)
+            {
+                const auto i = ispecies[j];
+                Hxx.col(i).fill(0.0);
+                Hxx.col(i).segment(offset, length) = (ln_a_x.col(i - offset) - ln_a_xx)/nsum;
+                if(length == 1)
+                    Hxx(i, i) += tau/(n[i].val() * n[i].val()); // the log-barrier contribution of a pure phase species (see updateF)
+            }
+        }
+
+        ispecies.resize(kept);
+    }
+
+    /// Update the columns of Hxx corresponding to the species in `ispecies` (sorted in ascending order) using compressed columns.
+    /// In each pass, the amounts of one species from each phase are seeded simultaneously and only these phases are
+    /// re-evaluated. Because the rows of Hxx corresponding to a phase depend only on the amounts of species in that
+    /// phase, the directional derivative of F along the sum of the seeded directions contains, in the rows of each
+    /// phase, the entries of the column of Hxx of the species seeded in that phase. Thus, the number of passes is the
+    /// number of species in the largest phase (instead of the number of species in the system).
+    auto updateGradNCompressed() -> void
+    {
+        const auto size = ispecies.size();
+
+        iblocks.clear();
+        for(auto k = 0; k < size;)
+        {
+            const auto start = k;
+            const auto iphase = iphases[ispecies[k]];
+            while(k < size && iphases[ispecies[k]] == iphase)
+                ++k;
+            iblocks.push_back({ start, k });
+        }
+
+        for(auto j = 0; ; ++j)
+        {
+            iseeded.clear();
+            for(auto const& [start, end] : iblocks)
+                if(start + j < end)
+                    iseeded.push_back(ispecies[start + j]);
+
+            if(iseeded.empty())
+                break;
+
+            for(auto i : iseeded)
+            {
+                autodiff::seed(n[i]);
+                props.updatePhase(iphases[i], n, p, w, useIdealModelForGradWrtVariableN(i));
+            }
+
+            props.collectDerivativesPhases(iseeded); // one column of du/dn per seeded species (if being collected)
+
+            for(auto i : iseeded)
+                updateFPhase(iphases[i]);
+
+            for(auto i : iseeded)
+                autodiff::unseed(n[i]);
+
+            for(auto i : iseeded)
+            {
+                const auto iphase = iphases[i];
+                const auto offset = ioffsets[iphase];
+                const auto length = ioffsets[iphase + 1] - offset;
+                Hxx.col(i).fill(0.0);
+                Hxx.col(i).segment(offset, length) = grad(F.segment(offset, length));
+            }
+        }
+
+        // Re-evaluate the seeded phases without seeded variables (see comment in updateGradN)
+        for(auto const& [start, end] : iblocks)
+            props.updatePhase(iphases[ispecies[start]], n, p, w, options.use_ideal_activity_models);
     }
 
     auto updateGradP() -> void
@@ -269,8 +646,13 @@ struct EquilibriumSetup::Impl
 
     auto updateGradW() -> void
     {
-        // Update Hxc and Vpc
-        for(auto i = 0; i < Nw; ++i)
+        // Update Hxc and Vpc (only the columns of the input variables for which sensitivity derivatives are requested)
+        if(iwsensitivity.size() < Nw)
+        {
+            Hxc.leftCols(Nw).fill(0.0);
+            Vpc.leftCols(Nw).fill(0.0);
+        }
+        for(auto i : iwsensitivity)
         {
             updateFw(i);
             Hxc.col(i) = grad(F.head(Nx));
@@ -280,6 +662,25 @@ struct EquilibriumSetup::Impl
         Vpc.rightCols(Nc).fill(0.0); // these are derivatives w.r.t. amounts of conservative components
     }
 
+    auto updateSensitivityInputs() -> void
+    {
+        auto const& inputs = options.sensitivity.inputs;
+        if(!inputs)
+        {
+            iwsensitivity = range(Nw);
+            return;
+        }
+        Indices iw;
+        for(auto const& input : inputs.value())
+        {
+            const auto i = index(specs.inputs(), input);
+            errorif(i >= Nw, "Could not restrict the sensitivity derivatives to input variable `", input, "` because it is not an input variable of the equilibrium problem. "
+                "The input variables are: ", join(specs.inputs(), ", "), ".");
+            iw.push_back(i);
+        }
+        iwsensitivity = iw;
+    }
+
     auto updateF() -> void
     {
         auto const& qvars = specs.controlVariablesQ();
@@ -310,6 +711,32 @@ struct EquilibriumSetup::Impl
         vp = econstraints.fn(props, p, w);
     }
 
+    /// Update the entries of F corresponding to the species in a phase (used when Hxx is block-diagonal, see @ref usingBlockDiagonalDerivatives).
+    auto updateFPhase(Index iphase) -> void
+    {
+        auto const& state = props.chemicalState();
+        auto const& props = state.props();
+
+        auto const& T = props.temperature();
+        auto const& n = props.speciesAmounts();
+
+        const auto offset = ioffsets[iphase];
+        const auto length = ioffsets[iphase + 1] - offset;
+
+        // Update the chemical potentials of the species in the phase at current iteration
+        mu.segment(offset, length) = props.speciesChemicalPotentials().segment(offset, length);
+
+        const auto RT  = universalGasConstant * T;
+        const auto tau = options.epsilon * options.logarithm_barrier_factor;
+
+        auto gn = F.segment(offset, length); // the segment in F where we set the chemical potentials of the species in the phase
+
+        gn = mu.segment(offset, length)/RT; // set the current chemical potentials of the species in the phase (normalized by RT)
+
+        if(length == 1)
+            gn[0] -= tau/n[offset]; // add log barrier contribution to a pure phase species
+    }
+
     auto updateFn(Index i) -> void
     {
         const auto useIdealModel = useIdealModelForGradWrtVariableN(i); // in case of little or no dependency of the thermochemical properties on n[i] (i.e., chemical props should have very little dependency in general on tiny species amounts)
@@ -320,6 +747,18 @@ struct EquilibriumSetup::Impl
         autodiff::unseed(n[i]);
     }
 
+    auto updateFnPhase(Index iphase, Index i) -> void
+    {
+        const auto useIdealModel = useIdealModelForGradWrtVariableN(i); // see comment in updateFn
+        const auto inpw = i; // the index of n[i] in the extended vector (n, p, w)
+        autodiff::seed(n[i]);
+        props.updatePhase(iphase, n, p, w, useIdealModel, inpw);
+        if(usingBlockDiagonalDerivatives())
+            updateFPhase(iphase);
+        else updateF();
+        autodiff::unseed(n[i]);
+    }
+
     auto updateFq(Index i) -> void
     {
         const auto useIdealModel = useIdealModelForGradWrtVariableQ(i); // in case of little or no dependency of the thermochemical properties on q[i] (i.e., chemical props has no dependency on amounts of implicit titrants such as [H+] when fixing pH)
@@ -417,12 +856,12 @@ struct EquilibriumSetup::Impl
 
     auto usingPartiallyExactDerivatives() -> bool
     {
-        return options.hessian == GibbsHessian::PartiallyExact;
+        return hessianmode == GibbsHessian::PartiallyExact;
     }
 
     auto usingDiagonalApproxDerivatives() -> bool
     {
-        return options.hessian == GibbsHessian::ApproxDiagonal;
+        return hessianmode == GibbsHessian::ApproxDiagonal;
     }
 
     auto useIdealModelForGradWrtVariableN(Index i) -> bool
@@ -430,7 +869,7 @@ struct EquilibriumSetup::Impl
         if(options.use_ideal_activity_models)
             return true;
 
-        switch(options.hessian)
+        switch(hessianmode)
         {
         case GibbsHessian::Exact:          return false;
         case GibbsHessian::Approx:         return true;
@@ -486,6 +925,21 @@ auto EquilibriumSetup::operator=(EquilibriumSetup other) -> EquilibriumSetup&
 auto EquilibriumSetup::setOptions(EquilibriumOptions const& opts) -> void
 {
     pimpl->options = opts;
+    pimpl->gradxvalid = false;
+    pimpl->resetHessianMode();
+    pimpl->updateSensitivityInputs();
+}
+
+auto EquilibriumSetup::setInactiveSpecies(Indices const& ispecies) -> void
+{
+    auto& isinactive = pimpl->isinactive;
+    pimpl->gradxvalid = false;
+    isinactive.fill(0);
+    for(auto i : ispecies)
+    {
+        errorif(i >= pimpl->Nn, "Expecting indices of species smaller than ", pimpl->Nn, " in EquilibriumSetup::setInactiveSpecies, but got ", i, ".");
+        isinactive[i] = 1;
+    }
 }
 
 auto EquilibriumSetup::dims() const -> EquilibriumDims const&
@@ -528,6 +982,16 @@ auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const&
     return pimpl->assembleUpperBoundsVector(restrictions, state0);
 }
 
+auto EquilibriumSetup::assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
+{
+    pimpl->assembleLowerBoundsVector(restrictions, state0, xlower);
+}
+
+auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
+{
+    pimpl->assembleUpperBoundsVector(restrictions, state0, xupper);
+}
+
 auto EquilibriumSetup::update(VectorXrConstRef x, VectorXrConstRef p, VectorXrConstRef w) -> void
 {
     pimpl->update(x, p, w);
@@ -603,13 +1067,30 @@ auto EquilibriumSetup::usingDiagonalApproxDerivatives() -> bool
     return pimpl->usingDiagonalApproxDerivatives();
 }
 
+auto EquilibriumSetup::sensitivityInputs() const -> Indices const&
+{
+    return pimpl->iwsensitivity;
+}
+
+auto EquilibriumSetup::hessianMode() const -> GibbsHessian
+{
+    return pimpl->hessianmode;
+}
+
+auto EquilibriumSetup::resetHessianMode() -> void
+{
+    pimpl->resetHessianMode();
+}
+
 auto EquilibriumSetup::assembleChemicalPropsJacobianBegin() -> void
 {
-    pimpl->props.assembleFullJacobianBegin();
+    pimpl->assembling_jacobian = true;
+    pimpl->props.assembleFullJacobianBegin(pimpl->gradxdudn && pimpl->isGradXPointUpToDate()); // keep du/dn recorded with Hxx at the current point
 }
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianEnd() -> void
 {
+    pimpl->assembling_jacobian = false;
     pimpl->props.assembleFullJacobianEnd();
 }
 
@@ -33,6 +33,7 @@ class EquilibriumProps;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
 struct EquilibriumOptions;
+enum class GibbsHessian;
 
 /// Used to construct the optimization problem for a chemical equilibrium calculation.
 class EquilibriumSetup
@@ -53,6 +54,15 @@ public:
     /// Set the options for the solution of the equilibrium problem.
     auto setOptions(EquilibriumOptions const& options) -> void;
 
+    /// Set the species considered inactive in the next calculations (e.g., species pinned at their lower bounds in previous calculations).
+    /// The columns of the Hessian of the Gibbs energy function corresponding to
+    /// these species are computed using a diagonal approximation instead of
+    /// automatic differentiation when its calculation mode is GibbsHessian::Exact
+    /// and there are no *p* control variables. With GibbsHessian::PartiallyExact,
+    /// these columns are already approximated, as inactive species are not primary.
+    /// @param ispecies The indices of the inactive species (an empty vector means all species are active)
+    auto setInactiveSpecies(Indices const& ispecies) -> void;
+
     /// Return the dimensions of the variables in the equilibrium problem.
     auto dims() const -> EquilibriumDims const&;
 
@@ -81,6 +91,18 @@ public:
     /// @param state0 The initial chemical state of the system.
     auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd;
 
+    /// Assemble the lower bound vector `xlower` in the optimization problem where *x = (n, q)*.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xlower The lower bound vector (of size *Nx*) to be assembled in place.
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void;
+
+    /// Assemble the upper bound vector `xupper` in the optimization problem where *x = (n, q)*.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xupper The upper bound vector (of size *Nx*) to be assembled in place.
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void;
+
     /// Update the chemical potentials and residuals of the equilibrium constraints.
     /// @param x The amounts of the species and implicit titrants, @eq{x = (n, q)}.
     /// @param p The values of the *p* control variables (e.g., temperature, pressure, and/or amounts of explicit titrants).
@@ -95,6 +117,8 @@ public:
     auto updateGradP() -> void;
 
     /// Update the derivatives of the chemical potentials and residuals of the equilibrium constraints with respect to *w*.
+    /// Only the derivatives with respect to the input variables given by
+    /// @ref sensitivityInputs are computed, and the others are set to zero.
     auto updateGradW() -> void;
 
     /// Get the updated Gibbs energy value.
@@ -130,6 +154,19 @@ public:
     /// Return true if a diagonal structure is adopted for the Hessian matrix *Hxx*.
     auto usingDiagonalApproxDerivatives() -> bool;
 
+    /// Return the calculation mode of the Hessian matrix *Hxx* in use.
+    /// This is `EquilibriumOptions::hessian`, unless it is GibbsHessian::Adaptive,
+    /// in which case this is the mode chosen for the current step of the calculation.
+    auto hessianMode() const -> GibbsHessian;
+
+    /// Restart the selection of the calculation mode of the Hessian matrix *Hxx* when this is GibbsHessian::Adaptive.
+    /// Call this method at the beginning of every equilibrium calculation.
+    auto resetHessianMode() -> void;
+
+    /// Return the indices of the input variables *w* with respect to which sensitivity derivatives are computed.
+    /// These are all input variables unless `EquilibriumOptions::sensitivity.inputs` is given.
+    auto sensitivityInputs() const -> Indices const&;
+
     /// Enable recording of derivatives of the chemical properties with respect
     /// to *(n, p, w)* to construct its full Jacobian matrix.
     /// Consider a series of forward automatic differentiation passes to
@@ -19,6 +19,8 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Core/ActivityModel.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -27,13 +29,35 @@
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIonExchange.hpp>
 using namespace Reaktoro;
 
 using autodiff::jacobian;
 using autodiff::wrt;
 using autodiff::at;
 
-namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+namespace test {
+
+    extern auto createChemicalSystem() -> ChemicalSystem;
+
+    auto getPhreeqcDatabase(const String& name) -> PhreeqcDatabase;
+
+} // namespace test
+
+namespace {
+
+/// Return the number of times a scope with given name was entered in a profile (including its nested occurrences).
+auto countProfilerCalls(ProfilerNode const& node, String const& name) -> Index
+{
+    auto calls = node.name == name ? node.calls : Index(0);
+    for(auto const& child : node.children)
+        calls += countProfilerCalls(child, name);
+    return calls;
+}
+
+} // namespace
 
 TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
 {
@@ -327,6 +351,233 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
 
             CHECK( setup.getConstraintResidualsGradX().size() == 0 );
             CHECK( setup.getConstraintResidualsGradP().size() == 0 );
+
+            for(auto mode : { GibbsHessian::Exact, GibbsHessian::PartiallyExact })
+            {
+                options.hessian = mode;
+                options.hessian_phase_blocks = true;
+                options.hessian_column_compression = false;
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.updateGradX(ibasicvars);
+                const MatrixXd Hxx = setup.getGibbsHessianX();
+
+                options.hessian_column_compression = true; // several columns of Hxx computed in each pass
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.updateGradX(ibasicvars);
+
+                CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+                CHECK( fn.isApprox(setup.getGibbsGradX()) ); // properties of the phases must have been restored
+
+                // Check the derivatives of the chemical properties wrt n collected with several seeded phases per pass
+                setup.assembleChemicalPropsJacobianBegin();
+                setup.updateGradX(ibasicvars);
+                setup.assembleChemicalPropsJacobianEnd();
+                const MatrixXd dudn = setup.equilibriumProps().dudn();
+
+                options.hessian_column_compression = false;
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.assembleChemicalPropsJacobianBegin();
+                setup.updateGradX(ibasicvars);
+                setup.assembleChemicalPropsJacobianEnd();
+
+                CHECK( dudn.cwiseAbs().maxCoeff() > 0.0 );
+                CHECK( dudn.isApprox(setup.equilibriumProps().dudn()) );
+                CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+
+                options.hessian_column_compression = false;
+                options.hessian_phase_blocks = false; // all entries of Hxx computed without exploiting its block-diagonal structure
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.updateGradX(ibasicvars);
+
+                CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+
+                // Check the entries of Hxx outside its diagonal blocks (one block per phase) are zero
+                MatrixXd Hblocks = zeros(Nn, Nn);
+                auto offset = 0;
+                for(auto const& phase : system.phases())
+                {
+                    const auto size = phase.species().size();
+                    Hblocks.block(offset, offset, size, size) = Hxx.block(offset, offset, size, size);
+                    offset += size;
+                }
+
+                CHECK( Hxx == Hblocks );
+            }
+
+            // Attach analytic derivatives to the mock activity models of the phases (i.e., ln(a) = c*x with c = 0.9, 9.0, 9.1)
+            Vec<Phase> phases;
+            for(auto const& phase : system.phases())
+            {
+                const auto c = phase.name() == "AqueousPhase" ? 0.9 : phase.name() == "GaseousPhase" ? 9.0 : 9.1;
+                phases.push_back(phase.withActivityDerivsModel([=](ActivityDerivs& derivs, ActivityModelArgs args)
+                {
+                    const auto N = args.x.size();
+                    derivs.ln_a_T.setZero(N);
+                    derivs.ln_a_P.setZero(N);
+                    derivs.ln_a_x = c * MatrixXd::Identity(N, N);
+                }));
+            }
+
+            ChemicalSystem asystem(system.database(), phases, system.reactions(), system.surfaces());
+
+            EquilibriumSpecs aspecs(asystem);
+            aspecs.temperature();
+            aspecs.pressure();
+
+            EquilibriumSetup asetup(aspecs);
+
+            for(auto mode : { GibbsHessian::Exact, GibbsHessian::PartiallyExact })
+            {
+                options.hessian = mode;
+                options.hessian_column_compression = false;
+                options.hessian_analytic_activity_derivs = false;
+                asetup.setOptions(options);
+                asetup.update(x, p, w);
+                asetup.updateGradX(ibasicvars);
+                const MatrixXd Hxx = asetup.getGibbsHessianX();
+
+                options.hessian_analytic_activity_derivs = true; // columns of Hxx computed from the analytic derivatives of the activity models
+                asetup.setOptions(options);
+                asetup.update(x, p, w);
+                asetup.updateGradX(ibasicvars);
+
+                CHECK( Hxx.isApprox(asetup.getGibbsHessianX()) );
+                CHECK( fn.isApprox(asetup.getGibbsGradX()) );
+            }
+
+            // Check Hxx is computed again only when the point, the basic variables, or the options change
+            auto counter = 0; // the number of evaluations of the activity models of the phases
+
+            Vec<Phase> cphases;
+            for(auto const& phase : system.phases())
+            {
+                const auto model = phase.activityModel();
+                cphases.push_back(phase.withActivityModel([=, &counter](ActivityPropsRef props, ActivityModelArgs args)
+                {
+                    counter += 1;
+                    model(props, args);
+                }));
+            }
+
+            ChemicalSystem csystem(system.database(), cphases, system.reactions(), system.surfaces());
+
+            EquilibriumSpecs cspecs(csystem);
+            cspecs.temperature();
+            cspecs.pressure();
+
+            EquilibriumSetup csetup(cspecs);
+
+            options = EquilibriumOptions();
+            csetup.setOptions(options);
+            csetup.update(x, p, w);
+
+            counter = 0;
+            csetup.updateGradX(ibasicvars);
+            CHECK( counter > 0 ); // the activity models are evaluated to compute the exact columns of Hxx
+
+            const MatrixXd Hxx0 = csetup.getGibbsHessianX();
+
+            csetup.update(x, p, w);
+
+            counter = 0;
+            csetup.updateGradX(ibasicvars); // Hxx is reused here
+            CHECK( counter == 0 );
+            CHECK( Hxx0 == csetup.getGibbsHessianX() );
+
+            VectorXl ibasicvars1 = VectorXl{{0, 1, 2}};
+
+            counter = 0;
+            csetup.updateGradX(ibasicvars1); // Hxx is not reused here since the basic variables have changed
+            CHECK( counter > 0 );
+
+            const ArrayXr x1 = 2.0 * x;
+            csetup.update(x1, p, w);
+
+            counter = 0;
+            csetup.updateGradX(ibasicvars); // Hxx is not reused here since the point has changed
+            CHECK( counter > 0 );
+
+            const MatrixXd Hxx1 = csetup.getGibbsHessianX();
+
+            EquilibriumSetup fresh(cspecs);
+            fresh.setOptions(options);
+            fresh.update(x1, p, w);
+            fresh.updateGradX(ibasicvars);
+
+            CHECK_FALSE( Hxx1.isApprox(Hxx0) );
+            CHECK( Hxx1.isApprox(fresh.getGibbsHessianX()) );
+
+            options.hessian = GibbsHessian::Exact;
+            csetup.setOptions(options);
+            csetup.update(x1, p, w);
+
+            counter = 0;
+            csetup.updateGradX(ibasicvars); // Hxx is not reused here since the options have changed
+            CHECK( counter > 0 );
+
+            counter = 0;
+            csetup.resetHessianMode();
+            csetup.updateGradX(ibasicvars); // Hxx is not reused here since a new calculation starts
+            CHECK( counter > 0 );
+
+            // Check Hxx and the derivatives of the chemical properties wrt n are reused when the sensitivity derivatives are computed at the same point
+            csetup.updateGradX(ibasicvars);
+
+            counter = 0;
+            csetup.assembleChemicalPropsJacobianBegin();
+            csetup.updateGradX(ibasicvars); // Hxx is reused here
+            csetup.assembleChemicalPropsJacobianEnd();
+            CHECK( counter == 0 );
+
+            fresh.setOptions(options);
+            fresh.update(x1, p, w);
+            fresh.assembleChemicalPropsJacobianBegin();
+            fresh.updateGradX(ibasicvars);
+            fresh.assembleChemicalPropsJacobianEnd();
+
+            CHECK( csetup.equilibriumProps().dudn().cwiseAbs().maxCoeff() > 0.0 );
+            CHECK( csetup.equilibriumProps().dudn().isApprox(fresh.equilibriumProps().dudn()) );
+
+            options.sensitivity.chemical_props = false; // the derivatives of the chemical properties wrt n are not recorded with Hxx now
+            csetup.setOptions(options);
+            csetup.update(x1, p, w);
+            csetup.updateGradX(ibasicvars);
+
+            counter = 0;
+            csetup.assembleChemicalPropsJacobianBegin();
+            csetup.updateGradX(ibasicvars); // Hxx is not reused here since the derivatives of the chemical properties wrt n are needed
+            csetup.assembleChemicalPropsJacobianEnd();
+            CHECK( counter > 0 );
+            CHECK( csetup.equilibriumProps().dudn().isApprox(fresh.equilibriumProps().dudn()) );
+
+#ifndef REAKTORO_DISABLE_PROFILING
+            // Check only the phases whose species amounts have changed are evaluated again with the default options (i.e., GibbsHessian::PartiallyExact)
+            options = EquilibriumOptions();
+            setup.setOptions(options);
+            setup.update(x, p, w);
+            setup.updateGradX(ibasicvars);
+
+            const auto Naq = system.phase(0).species().size(); // the basic variables in ibasicvars correspond to aqueous species
+
+            ArrayXr x2 = x;
+            x2.head(Naq) *= 2.0; // the amounts of the species in the gaseous and mineral phases are unchanged
+
+            Profiler::reset();
+            Profiler::enable(true);
+            setup.update(x2, p, w);
+            setup.updateGradX(ibasicvars);
+            Profiler::enable(false);
+
+            // The aqueous phase is evaluated once for the new point and once per column of Hxx corresponding
+            // to a basic variable, instead of all phases in the system in each of these evaluations
+            CHECK( countProfilerCalls(Profiler::report(), "ChemicalPropsPhase::update") == Index(1 + ibasicvars.size()) );
+
+            Profiler::reset();
+#endif
         }
 
         WHEN("temperature and pressure are not input variables")
@@ -489,18 +740,22 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
 
                 for(auto mode : modes)
                 {
-                    options.hessian = mode;
+                    for(auto phaseblocks : { true, false }) // with and without phase-by-phase computation of Hessian columns
+                    {
+                        options.hessian = mode;
+                        options.hessian_phase_blocks = phaseblocks;
 
-                    setup.setOptions(options);
-                    setup.update(x, p, w);
-                    setup.updateGradX(ibasicvars);
-                    setup.updateGradP();
+                        setup.setOptions(options);
+                        setup.update(x, p, w);
+                        setup.updateGradX(ibasicvars);
+                        setup.updateGradP();
 
-                    const auto Hxx = jacobian(gfn, wrt(x), at(x, p));
-                    const auto Hxp = jacobian(gfn, wrt(p), at(x, p));
+                        const auto Hxx = jacobian(gfn, wrt(x), at(x, p));
+                        const auto Hxp = jacobian(gfn, wrt(p), at(x, p));
 
-                    CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
-                    CHECK( Hxp.isApprox(setup.getGibbsHessianP()) );
+                        CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+                        CHECK( Hxp.isApprox(setup.getGibbsHessianP()) );
+                    }
                 }
             }
 
@@ -547,20 +802,80 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
 
                 for(auto mode : modes)
                 {
-                    options.hessian = mode;
+                    for(auto phaseblocks : { true, false }) // with and without phase-by-phase computation of Hessian columns
+                    {
+                        options.hessian = mode;
+                        options.hessian_phase_blocks = phaseblocks;
 
-                    setup.setOptions(options);
-                    setup.update(x, p, w);
-                    setup.updateGradX(ibasicvars);
-                    setup.updateGradP();
+                        setup.setOptions(options);
+                        setup.update(x, p, w);
+                        setup.updateGradX(ibasicvars);
+                        setup.updateGradP();
 
-                    const auto Vpx = jacobian(vfn, wrt(x), at(x, p));
-                    const auto Vpp = jacobian(vfn, wrt(p), at(x, p));
+                        const auto Vpx = jacobian(vfn, wrt(x), at(x, p));
+                        const auto Vpp = jacobian(vfn, wrt(p), at(x, p));
 
-                    CHECK( Vpx.isApprox(setup.getConstraintResidualsGradX()) );
-                    CHECK( Vpp.isApprox(setup.getConstraintResidualsGradP()) );
+                        CHECK( Vpx.isApprox(setup.getConstraintResidualsGradX()) );
+                        CHECK( Vpp.isApprox(setup.getConstraintResidualsGradP()) );
+                    }
                 }
             }
         }
     }
 }
+
+TEST_CASE("Testing EquilibriumSetup with an ion exchange phase", "[EquilibriumSetup]")
+{
+    // The activity model of the ion exchange phase depends on the state of the aqueous phase (see ActivityModelIonExchange)
+    const auto db = test::getPhreeqcDatabase("phreeqc.dat");
+
+    Phases phases(db);
+    phases.add( AqueousPhase("H2O H+ OH- Na+ Cl- Ca+2").set(ActivityModelDavies()) );
+    phases.add( IonExchangePhase("NaX CaX2").set(ActivityModelIonExchange()) );
+
+    ChemicalSystem system(phases);
+
+    const auto Nn = system.species().size();
+    const auto Na = system.phase(0).species().size(); // the number of aqueous species
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    const auto p = ArrayXr{};
+    const auto n = ArrayXr::LinSpaced(Nn, 0.1, 1.0);
+
+    const ArrayXr x = n; // there are no *q* control variables in the problem
+
+    VectorXr w{{298.15, 1.0e5}};
+
+    VectorXl ibasicvars = VectorXl{{0, 1, 2, 3}};
+
+    EquilibriumSetup setup(specs);
+
+    EquilibriumOptions options;
+
+    for(auto mode : { GibbsHessian::Exact, GibbsHessian::PartiallyExact })
+    {
+        options.hessian = mode;
+        options.hessian_phase_blocks = false;
+        options.hessian_column_compression = false;
+        options.hessian_analytic_activity_derivs = false;
+        setup.setOptions(options);
+        setup.update(x, p, w);
+        setup.updateGradX(ibasicvars);
+        const MatrixXd Hxx = setup.getGibbsHessianX();
+
+        // The derivatives of the chemical potentials of the exchange species with respect to the amounts of aqueous species are not zero
+        CHECK( Hxx.bottomLeftCorner(Nn - Na, Na).cwiseAbs().maxCoeff() > 0.0 );
+
+        options.hessian_phase_blocks = true; // ignored since the ion exchange phase depends on the aqueous phase
+        options.hessian_column_compression = true;
+        options.hessian_analytic_activity_derivs = true;
+        setup.setOptions(options);
+        setup.update(x, p, w);
+        setup.updateGradX(ibasicvars);
+
+        CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+    }
+}
@@ -26,9 +26,11 @@
 #include <Optima/State.hpp>
 
 // Reaktoro includes
-#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -41,6 +43,8 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumWarmStartCache.hpp>
 
 namespace Reaktoro {
 
@@ -86,6 +90,9 @@ struct EquilibriumSolver::Impl
     /// The optimization state of the calculation.
     Optima::State optstate;
 
+    /// The backup of the optimization state used to restart the calculation in case the first attempt fails.
+    Optima::State optstatebkp;
+
     /// The optimization sensitivity of the calculation.
     Optima::Sensitivity optsensitivity;
 
@@ -95,15 +102,55 @@ struct EquilibriumSolver::Impl
     /// The result of the equilibrium calculation
     EquilibriumResult result;
 
-    /// The array stream used to clean up autodiff seed values from the last ChemicalProps update step.
-    ArrayStream<double> stream;
+    /// The input variables *w* of the current equilibrium calculation (used in the callback functions of the Optima::Problem object).
+    VectorXr w;
+
+    /// The index of temperature in the input variables *w* (equal to the number of input variables if temperature is not an input).
+    const Index iTw;
+
+    /// The index of pressure in the input variables *w* (equal to the number of input variables if pressure is not an input).
+    const Index iPw;
+
+    /// The solutions of previous calculations used to warm-start calculations from cold chemical states.
+    EquilibriumWarmStartCache warmstarts;
+
+    /// The flag indicating if the current calculation starts without a previous solution (neither in the chemical state nor in the warm-start cache).
+    bool coldstart = false;
+
+    /// The number of consecutive calculations in which each species has remained pinned at its lower bound.
+    Indices pinnedcounts;
+
+    /// The indices of the species currently considered inactive (see EquilibriumOptions::inactive_species_threshold).
+    Indices iinactive;
+
+    /// The performance data of the recent calculations (see EquilibriumOptions::trace_size).
+    EquilibriumTrace trace;
+
+    /// The performance data of the current calculation.
+    EquilibriumTraceRecord tracerecord;
+
+    /// The time point at which the current calculation started (used when recording its performance data).
+    Time tracestart;
 
     /// Construct a Impl instance with given EquilibriumConditions object.
     Impl(EquilibriumSpecs const& specs)
-    : system(specs.system()), specs(specs), dims(specs), xconditions(specs), xrestrictions(system), setup(specs)
+    : system(specs.system()), specs(specs), dims(specs), xconditions(specs), xrestrictions(system), setup(specs),
+      iTw(index(specs.namesInputs(), "T")), iPw(index(specs.namesInputs(), "P")), pinnedcounts(dims.Nn, 0)
     {
         // Initialize the equilibrium solver with the default options
         setOptions(options);
+
+        // Initialize the optimization problem that is reused in every equilibrium calculation
+        initOptProblem();
+    }
+
+    /// Construct a copy of an Impl instance.
+    Impl(Impl const& other)
+    : Impl(other.specs)
+    {
+        // Note: The Impl object is not copied member by member because the callback functions in
+        // the Optima::Problem object capture `this`, and so they must refer to the new Impl object.
+        setOptions(other.options);
     }
 
     /// Set the options of the equilibrium solver.
@@ -150,14 +197,30 @@ struct EquilibriumSolver::Impl
 
         // Pass along the options used for the calculation to Optima::Solver object
         optsolver.setOptions(options.optima);
+
+        // Reactivate all species if the detection of inactive species is disabled
+        if(options.inactive_species_threshold == 0 && !iinactive.empty())
+        {
+            std::fill(pinnedcounts.begin(), pinnedcounts.end(), 0);
+            iinactive.clear();
+            setup.setInactiveSpecies(iinactive);
+        }
+
+        // Reset the trace of the calculations only if its capacity has changed
+        if(trace.capacity() != options.trace_size)
+            trace = EquilibriumTrace(options.trace_size);
+
+        // Reset the warm-start cache only if its configuration has changed (note this method is also called when retrying a failed calculation)
+        if(warmstarts.capacity() != options.warmstart_cache_size || warmstarts.resolution() != options.warmstart_cache_resolution)
+            warmstarts = EquilibriumWarmStartCache(options.warmstart_cache_size, options.warmstart_cache_resolution);
     }
 
-    /// Update the optimization problem before a new equilibrium calculation.
-    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    /// Initialize the optimization problem with the data that do not change among equilibrium calculations.
+    /// The Optima::Problem object, its callback functions, and the coefficient matrices of the linear
+    /// equality constraints are created only once. Before each calculation, only those vectors that depend on
+    /// the initial chemical state, the given conditions and restrictions are updated (see @ref updateOptProblem).
+    auto initOptProblem() -> void
     {
-        // The input variables for the equilibrium calculation
-        const VectorXr w = conditions.inputValuesGetOrCompute(state0);
-
         // Create the Optima::Dims object with dimension info of the optimization problem
         optdims = Optima::Dims();
         optdims.x  = dims.Nx;
@@ -165,15 +228,38 @@ struct EquilibriumSolver::Impl
         optdims.be = dims.Nc;
         optdims.c  = dims.Nw + dims.Nc; // c' = (w, c) where w are the input variables and c are the amounts of components
 
-        // Recreate a new Optima::Problem problem (TODO: Avoid recreation of Optima::Problem object for each equilibrium calculation)
+        // Create the Optima::Problem object that is reused in all equilibrium calculations
         optproblem = Optima::Problem(optdims);
 
+        // Allocate the input variables w once (they are updated in place before each calculation)
+        w.resize(dims.Nw);
+
         // Set the resources function in the Optima::Problem object
-        optproblem.r = [=](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts) mutable
+        optproblem.r = [this](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts)
         {
+            const auto tracing = options.trace_size > 0;
+
+            const auto start = tracing ? time() : Time();
+
             setup.update(x, p, w);
 
-            if(fopts.eval.fxc || vopts.eval.ddc)
+            const auto derivatives = fopts.eval.fxx || vopts.eval.ddx || fopts.eval.fxp || vopts.eval.ddp || fopts.eval.fxc || vopts.eval.ddc;
+
+            if(tracing)
+            {
+                tracerecord.time_props += elapsed(start);
+                tracerecord.backtracks += !derivatives;
+            }
+
+            if(!derivatives)
+                return;
+
+            const auto startderivatives = tracing ? time() : Time();
+
+            // The derivatives of the chemical properties are collected only if their total derivatives are needed in the sensitivity calculation
+            const auto assembling = (fopts.eval.fxc || vopts.eval.ddc) && options.sensitivity.chemical_props;
+
+            if(assembling)
                 setup.assembleChemicalPropsJacobianBegin();
 
             if(fopts.eval.fxx || vopts.eval.ddx)
@@ -183,12 +269,15 @@ struct EquilibriumSolver::Impl
             if(fopts.eval.fxc || vopts.eval.ddc)
                 setup.updateGradW();
 
-            if(fopts.eval.fxc || vopts.eval.ddc)
+            if(assembling)
                 setup.assembleChemicalPropsJacobianEnd();
+
+            if(tracing)
+                tracerecord.time_hessian += elapsed(startderivatives);
         };
 
         // Set the objective function in the Optima::Problem object
-        optproblem.f = [=](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts) mutable
+        optproblem.f = [this](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts)
         {
             res.f = setup.getGibbsEnergy();
             res.fx = setup.getGibbsGradX();
@@ -209,7 +298,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the external constraint function in the Optima::Problem object
-        optproblem.v = [=](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts) mutable
+        optproblem.v = [this](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts)
         {
             res.val = setup.getConstraintResiduals();
 
@@ -229,17 +318,6 @@ struct EquilibriumSolver::Impl
         optproblem.Aex = setup.Aex();
         optproblem.Aep = setup.Aep();
 
-        /// Set the right-hand side vector be of the linear equality constraints.
-        optproblem.be = conditions.initialComponentAmountsGetOrCompute(state0);
-
-        // Set the lower and upper bounds of the species amounts
-        optproblem.xlower = setup.assembleLowerBoundsVector(restrictions, state0);
-        optproblem.xupper = setup.assembleUpperBoundsVector(restrictions, state0);
-
-        // Set the lower and upper bounds of the *p* control variables
-        optproblem.plower = conditions.lowerBoundsControlVariablesP();
-        optproblem.pupper = conditions.upperBoundsControlVariablesP();
-
         // Set the values of the input variables for sensitivity derivatives
         optproblem.c = zeros(optdims.c);
 
@@ -249,18 +327,49 @@ struct EquilibriumSolver::Impl
         optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
     }
 
+    /// Update the optimization problem before a new equilibrium calculation.
+    /// Only the vectors that depend on the initial chemical state, conditions and restrictions are updated here (in place, without allocating memory).
+    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    {
+        // Update the input variables for the equilibrium calculation (used in the callback functions of the Optima::Problem object)
+        conditions.inputValuesGetOrCompute(state0, w);
+
+        /// Set the right-hand side vector be of the linear equality constraints.
+        conditions.initialComponentAmountsGetOrCompute(state0, optproblem.be);
+
+        // Set the lower and upper bounds of the species amounts
+        setup.assembleLowerBoundsVector(restrictions, state0, optproblem.xlower);
+        setup.assembleUpperBoundsVector(restrictions, state0, optproblem.xupper);
+
+        // Set the lower and upper bounds of the *p* control variables (copied into the already allocated vectors, since their sizes never change)
+        optproblem.plower = conditions.lowerBoundsControlVariablesP().matrix();
+        optproblem.pupper = conditions.upperBoundsControlVariablesP().matrix();
+
+        // Restart the selection of the calculation mode of the Hessian (in case it is GibbsHessian::Adaptive)
+        setup.resetHessianMode();
+    }
+
     /// Update the initial state variables before the new equilibrium calculation.
     auto updateOptState(ChemicalState const& state0)
     {
         // Initialize optstate with that stored in state0 (note state0 may have empty Optima::State object!)
         optstate = state0.equilibrium().optimaState();
 
-        // In case optstate corresponds to an equilibrium problem of different structure, initialize it with a clean slate
-        if(optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != dims.Nw + dims.Nc)  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
+        // Check if optstate corresponds to an equilibrium problem of different structure (i.e., state0 is a cold state for this solver)
+        const auto cold = optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != dims.Nw + dims.Nc;  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
+
+        // In case of a cold state, use the nearest previous solution in the warm-start cache (if any)
+        const auto cached = cold && warmstarts.nearest(temperature(state0), pressure(state0), optproblem.be, optstate);
+
+        // Otherwise, initialize optstate with a clean slate
+        if(cold && !cached)
             optstate = Optima::State(optdims);
 
-        // Overwrite n in x = (n, q) with species amounts from the chemical state
-        optstate.x.head(dims.Nn) = state0.speciesAmounts();
+        coldstart = cold && !cached;
+
+        // Overwrite n in x = (n, q) with species amounts from the chemical state (unless the primal solution from the warm-start cache is used)
+        if(!cached)
+            optstate.x.head(dims.Nn) = state0.speciesAmounts();
 
         // Overwrite delta variables in q with zeros (i.e., the amount of an implicit titrant to add/remove)
         optstate.x.tail(dims.Nq).fill(0.0);
@@ -279,6 +388,76 @@ struct EquilibriumSolver::Impl
             optstate.p[0] = state0.pressure();
     }
 
+    /// Update the species considered inactive in the next calculations using the solution of the current one.
+    /// A species is pinned if it is at its lower bound (within a factor of two, because of the log-barrier) with a
+    /// positive stability, and it becomes inactive after being pinned in a number of consecutive calculations.
+    auto updateInactiveSpecies(EquilibriumResult const& result) -> void
+    {
+        auto const& threshold = options.inactive_species_threshold;
+
+        if(threshold == 0 || !result.succeeded())
+            return;
+
+        auto const& x = optstate.x;
+        auto const& s = optstate.s;
+        auto const& xlower = optproblem.xlower;
+
+        iinactive.clear();
+        for(auto i = 0; i < dims.Nn; ++i)
+        {
+            const auto pinned = s[i] > 0.0 && x[i] <= 2.0 * xlower[i];
+            pinnedcounts[i] = pinned ? pinnedcounts[i] + 1 : 0;
+            if(pinnedcounts[i] >= threshold)
+                iinactive.push_back(i);
+        }
+
+        setup.setInactiveSpecies(iinactive);
+    }
+
+    /// Start recording the performance data of the current calculation (if enabled in the options).
+    auto traceBegin() -> void
+    {
+        if(options.trace_size == 0)
+            return;
+
+        tracerecord = {};
+        tracestart = time();
+    }
+
+    /// Finish recording the performance data of the current calculation (if enabled in the options).
+    auto traceEnd(EquilibriumResult const& result) -> void
+    {
+        if(options.trace_size == 0)
+            return;
+
+        tracerecord.time = elapsed(tracestart);
+        tracerecord.time_optima = std::max(tracerecord.time - tracerecord.time_props - tracerecord.time_hessian, 0.0);
+        tracerecord.iterations = result.iterations();
+        tracerecord.fallback = result.fallback;
+        tracerecord.succeeded = result.succeeded();
+
+        trace.record(tracerecord);
+    }
+
+    /// Return the temperature of the current calculation (given as input or the initial guess in the chemical state).
+    auto temperature(ChemicalState const& state0) const -> double
+    {
+        return iTw < dims.Nw ? w[iTw].val() : state0.temperature().val();
+    }
+
+    /// Return the pressure of the current calculation (given as input or the initial guess in the chemical state).
+    auto pressure(ChemicalState const& state0) const -> double
+    {
+        return iPw < dims.Nw ? w[iPw].val() : state0.pressure().val();
+    }
+
+    /// Store the solution of the current calculation in the warm-start cache if it succeeded.
+    auto updateWarmStartCache(ChemicalState const& state, EquilibriumResult const& result)
+    {
+        if(result.succeeded())
+            warmstarts.store(state.temperature().val(), state.pressure().val(), optproblem.be, optstate);
+    }
+
     /// Update the chemical state object with computed optimization state.
     auto updateChemicalState(ChemicalState& state, EquilibriumConditions const& conditions)
     {
@@ -286,19 +465,10 @@ struct EquilibriumSolver::Impl
         auto& props = state.props();
         props = setup.chemicalProps();
 
-        // TODO: In Optima, make sure check for convergence does not compute
-        // any derivatives. Use F.updateSkipJacobian(u) instead of F.update(u)
-        // in method MasterSolver::Impl::stepping. Once this is implemented,
-        // there will be no need for this method, because the chemical
-        // properties will be clean of derivatives (i.e., autodiff seed values
-        // will be zero). Once this is done, the next step of cleaning up such
-        // seed values can be removed.
-
         // Make sure the derivative information in the underlying chemical
-        // properties of the system are zeroed out!
-        ArrayStream<double> stream;
-        props.serialize(stream);
-        props.deserialize(stream);
+        // properties of the system are zeroed out (Optima may have left seeded
+        // values in them when checking for convergence)!
+        props.clearDerivatives();
 
         // Update other state variables in the ChemicalState object
         state.setTemperature(props.temperature());
@@ -323,6 +493,8 @@ struct EquilibriumSolver::Impl
         auto const& pc = optsensitivity.pc;
 
         auto const& props = setup.equilibriumProps();
+        auto const& iw = setup.sensitivityInputs();
+        auto const& ic = options.sensitivity.components;
 
         const auto dndw = xc.topLeftCorner(Nn, Nw);
         const auto dqdw = xc.bottomLeftCorner(Nq, Nw);
@@ -341,8 +513,39 @@ struct EquilibriumSolver::Impl
         sensitivity.dndc(dndc);
         sensitivity.dqdc(dqdc);
         sensitivity.dpdc(dpdc);
-        sensitivity.dudw(dudw + dudn*dndw + dudp*dpdw);
-        sensitivity.dudc(dudn*dndc + dudp*dpdc);
+
+        if(!options.sensitivity.chemical_props)
+        {
+            sensitivity.dudw(MatrixXd());
+            sensitivity.dudc(MatrixXd());
+            return;
+        }
+
+        const auto Nu = dudn.rows();
+
+        // Compute only the columns of the total derivatives of the chemical properties that have been requested
+        if(iw.size() == Nw)
+            sensitivity.dudw(dudw + dudn*dndw + dudp*dpdw);
+        else
+        {
+            MatrixXd dudwtotal = zeros(Nu, Nw);
+            for(auto i : iw)
+                dudwtotal.col(i) = dudw.col(i) + dudn*dndw.col(i) + dudp*dpdw.col(i);
+            sensitivity.dudw(dudwtotal);
+        }
+
+        if(!ic)
+            sensitivity.dudc(dudn*dndc + dudp*dpdc);
+        else
+        {
+            MatrixXd dudctotal = zeros(Nu, Nc);
+            for(auto i : ic.value())
+            {
+                errorif(i >= Nc, "Expecting indices of conservative components smaller than ", Nc, " in EquilibriumOptions::sensitivity.components, but got ", i, ".");
+                dudctotal.col(i) = dudn*dndc.col(i) + dudp*dpdc.col(i);
+            }
+            sensitivity.dudc(dudctotal);
+        }
     }
 
     auto solve(ChemicalState& state) -> EquilibriumResult
@@ -362,29 +565,117 @@ struct EquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
     {
+        solveInto(state, conditions, restrictions, result);
+        return result;
+    }
+
+    /// Equilibrate given chemical state and store the result of the calculation in given EquilibriumResult object (avoiding its copy).
+    auto solveInto(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions, EquilibriumResult& result) -> void
+    {
+        traceBegin();
+
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
-        const auto optstatebkp = optstate;
+        optstatebkp = optstate;
+
+        const auto iterations = precondition();
 
         result.optima = optsolver.solve(optproblem, optstate);
+        result.optima.iterations += iterations;
+        result.fallback = 0;
+
+        tracerecord.hessian = setup.hessianMode();
+
+        if(!result.optima.succeeded && !options.fallbacks.empty())
+            solveWithFallbacks(result);
+
+        warningif(!result.optima.succeeded && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
 
-        if(!result.optima.succeeded)
+        updateChemicalState(state, conditions);
+        updateWarmStartCache(state, result);
+        updateInactiveSpecies(result);
+        traceEnd(result);
+    }
+
+    /// Retry the failed calculation with the fallback strategies in the options until one of them succeeds.
+    auto solveWithFallbacks(EquilibriumResult& result) -> void
+    {
+        for(auto const& [i, fallback] : enumerate(options.fallbacks))
         {
-            auto optionsbkp = options;
-            options.optima.backtracksearch.apply_min_max_fix_and_accept = !options.optima.backtracksearch.apply_min_max_fix_and_accept;
-            setOptions(options);
-            optstate = optstatebkp;
+            auto opts = options;
+            opts.hessian = fallback.hessian.value_or(options.hessian);
+            opts.logarithm_barrier_factor = fallback.logarithm_barrier_factor.value_or(options.logarithm_barrier_factor);
+            opts.optima.maxiters = fallback.maxiters > 0 ? fallback.maxiters : options.optima.maxiters;
+            if(fallback.toggle_min_max_fix)
+                opts.optima.backtracksearch.apply_min_max_fix_and_accept = !options.optima.backtracksearch.apply_min_max_fix_and_accept;
+
+            // Continue from the last iterate of the previous attempt only if requested and if it is usable
+            if(fallback.restart || !optstate.x.allFinite() || !optstate.y.allFinite())
+                optstate = optstatebkp;
+
+            // Perform the initial iterations with ideal activity models to produce a new initial guess
+            const auto iterations = fallback.ideal_iterations > 0 ? solveIdeal(opts, opts.hessian, fallback.ideal_iterations) : 0;
+
+            applyOptions(opts);
+
             result.optima = optsolver.solve(optproblem, optstate);
-            options = optionsbkp;
-            setOptions(options);
+            result.optima.iterations += iterations;
+            result.fallback = i + 1;
+
+            if(result.optima.succeeded)
+                break;
         }
 
-        warningif(!result.optima.succeeded && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
+        applyOptions(options);
+    }
 
-        updateChemicalState(state, conditions);
+    /// Perform iterations with ideal activity models to improve the initial guess in the optimization state.
+    /// The optimization state is left unchanged if these iterations produce non-finite values.
+    /// @param opts The options of the calculation to be performed after these iterations
+    /// @param hessian The calculation mode of the Hessian of the Gibbs energy function in these iterations
+    /// @param maxiters The maximum number of these iterations
+    /// @return The number of performed iterations
+    auto solveIdeal(EquilibriumOptions const& opts, GibbsHessian hessian, Index maxiters) -> Index
+    {
+        if(opts.use_ideal_activity_models)
+            return 0;
 
-        return result;
+        auto idealopts = opts;
+        idealopts.use_ideal_activity_models = true;
+        idealopts.hessian = hessian;
+        idealopts.optima.maxiters = maxiters;
+
+        applyOptions(idealopts);
+
+        const auto optstate0 = optstate;
+        const auto optresult = optsolver.solve(optproblem, optstate);
+
+        if(!optstate.x.allFinite() || !optstate.y.allFinite())
+            optstate = optstate0;
+
+        applyOptions(opts);
+
+        return optresult.iterations;
+    }
+
+    /// Apply given options to the equilibrium setup and optimization solver during a calculation.
+    /// Unlike @ref setOptions, this does not store the given options nor rebuild the names of the
+    /// variables used in the output of the optimization solver.
+    auto applyOptions(EquilibriumOptions const& opts) -> void
+    {
+        setup.setOptions(opts);
+        optsolver.setOptions(opts.optima);
+    }
+
+    /// Perform the ideal preconditioning stage of a cold-start calculation if requested in the options (see EquilibriumOptions::ideal_preconditioning).
+    /// @return The number of performed iterations
+    auto precondition() -> Index
+    {
+        if(!coldstart || !options.ideal_preconditioning)
+            return 0;
+
+        return solveIdeal(options, GibbsHessian::ApproxDiagonal, options.ideal_preconditioning_maxiters);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> EquilibriumResult
@@ -406,16 +697,49 @@ struct EquilibriumSolver::Impl
     {
         EquilibriumResult result;
 
+        traceBegin();
+
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
+        const auto iterations = precondition();
+
         result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
+        result.optima.iterations += iterations;
+
+        tracerecord.hessian = setup.hessianMode();
 
         updateChemicalState(state, conditions);
         updateEquilibriumSensitivity(sensitivity);
+        updateWarmStartCache(state, result);
+        updateInactiveSpecies(result);
+        traceEnd(result);
 
         return result;
     }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void
+    {
+        results.resize(states.size());
+        for(auto i = 0; i < states.size(); ++i)
+            solveInto(states[i], xconditions, xrestrictions, results[i]);
+    }
+
+    auto solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void
+    {
+        results.resize(states.size());
+        for(auto i = 0; i < states.size(); ++i)
+            solveInto(states[i], conditions, xrestrictions, results[i]);
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void
+    {
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects "
+            "when equilibrating a batch of chemical states, but got ", states.size(), " and ", conditions.size(), " instead.");
+        results.resize(states.size());
+        for(auto i = 0; i < states.size(); ++i)
+            solveInto(states[i], conditions[i], xrestrictions, results[i]);
+    }
 };
 
 EquilibriumSolver::EquilibriumSolver(ChemicalSystem const& system)
@@ -479,9 +803,29 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sens
     return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, results);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, conditions, results);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, conditions, results);
+}
+
 auto EquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
 }
 
+auto EquilibriumSolver::trace() const -> EquilibriumTrace const&
+{
+    return pimpl->trace;
+}
+
 } // namespace Reaktoro
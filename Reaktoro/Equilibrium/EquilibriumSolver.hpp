@@ -31,6 +31,7 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
+class EquilibriumTrace;
 struct EquilibriumOptions;
 struct EquilibriumResult;
 
@@ -109,6 +110,34 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR A BATCH OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a batch of chemical states (e.g., one for each cell in a reactive transport mesh).
+    /// The chemical states are equilibrated one after the other, exactly as in
+    /// successive calls to @ref solve for a single chemical state, with the
+    /// results written directly into `results`. Only the cost of crossing the
+    /// interface of the solver once per chemical state is amortised; each
+    /// calculation still performs its own equilibrium iterations.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void;
+
+    /// Equilibrate a batch of chemical states respecting the same given constraint conditions.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for every chemical state
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void;
+
+    /// Equilibrate a batch of chemical states respecting given constraint conditions for each of them.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium, one for each chemical state
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -118,6 +147,9 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(EquilibriumOptions const& options) -> void;
 
+    /// Return the performance data of the recent calculations (empty unless EquilibriumOptions::trace_size is positive).
+    auto trace() const -> EquilibriumTrace const&;
+
 private:
     struct Impl;
 
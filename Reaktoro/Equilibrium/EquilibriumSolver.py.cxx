@@ -29,6 +29,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
 using namespace Reaktoro;
 
 void exportEquilibriumSolver(py::module& m)
@@ -48,5 +49,6 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &EquilibriumSolver::setOptions)
+        .def("trace", &EquilibriumSolver::trace, return_internal_ref, "Return the performance data of the recent calculations.")
         ;
 }
@@ -34,6 +34,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPhreeqc.hpp>
 using namespace Reaktoro;
@@ -295,6 +296,180 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
             CHECK( result.iterations() == 3 );
             checkChemicalEquilibriumStateHasZeroDerivativeValues(state);
         }
+
+        WHEN("using fallback strategies after a failed first attempt")
+        {
+            options.epsilon = 1e-16;
+            options.optima.maxiters = 5; // the first attempt fails because of too few iterations
+
+            options.fallbacks.clear();
+
+            solver.setOptions(options);
+
+            ChemicalState state1 = state;
+
+            result = solver.solve(state1);
+
+            CHECK( result.failed() );
+            CHECK( result.fallback == 0 );
+
+            EquilibriumFallback fallback1;
+            fallback1.maxiters = 5;
+            fallback1.restart = false;
+
+            EquilibriumFallback fallback2;
+            fallback2.maxiters = 100;
+            fallback2.restart = false;
+            fallback2.ideal_iterations = 3;
+            fallback2.hessian = GibbsHessian::Exact;
+
+            options.fallbacks = { fallback1, fallback2 };
+
+            solver.setOptions(options);
+
+            ChemicalState state2 = state;
+
+            result = solver.solve(state2);
+
+            CHECK( result.succeeded() );
+            CHECK( result.fallback == 2 );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state2);
+        }
+
+        WHEN("using a preconditioning stage with ideal activity models for cold chemical states")
+        {
+            options.epsilon = 1e-16;
+            options.ideal_preconditioning = true;
+            solver.setOptions(options);
+
+            ChemicalState state1 = state;
+
+            result = solver.solve(state1);
+
+            CHECK( result.succeeded() );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state1);
+
+            options.ideal_preconditioning = false;
+            solver.setOptions(options);
+
+            ChemicalState state2 = state;
+
+            result = solver.solve(state2);
+
+            CHECK( result.succeeded() );
+            CHECK( state1.speciesAmounts().matrix().isApprox(state2.speciesAmounts().matrix(), 1e-6) );
+        }
+
+        WHEN("using approximate Hessian columns for species pinned at their lower bounds")
+        {
+            options.epsilon = 1e-16;
+            options.hessian = GibbsHessian::Exact;
+            solver.setOptions(options);
+
+            ChemicalState state1 = state;
+
+            result = solver.solve(state1);
+
+            CHECK( result.succeeded() );
+
+            options.inactive_species_threshold = 1;
+            solver.setOptions(options);
+
+            ChemicalState state2 = state;
+
+            result = solver.solve(state2); // the species pinned at their lower bounds are detected here
+
+            CHECK( result.succeeded() );
+
+            state2.temperature(state.temperature() + 5.0);
+
+            result = solver.solve(state2); // the inactive species have approximate Hessian columns here
+
+            CHECK( result.succeeded() );
+
+            state1.temperature(state.temperature() + 5.0);
+
+            options.inactive_species_threshold = 0;
+            solver.setOptions(options);
+
+            result = solver.solve(state1);
+
+            CHECK( result.succeeded() );
+            CHECK( state1.speciesAmounts().matrix().isApprox(state2.speciesAmounts().matrix(), 1e-6) );
+        }
+
+        WHEN("using an adaptive calculation mode of the Hessian")
+        {
+            options.epsilon = 1e-16;
+            options.hessian = GibbsHessian::Adaptive;
+            options.trace_size = 1;
+            solver.setOptions(options);
+
+            ChemicalState state1 = state;
+
+            result = solver.solve(state1);
+
+            CHECK( result.succeeded() );
+            CHECK( solver.trace().records().back().fallback == 0 );
+            CHECK( solver.trace().records().back().hessian == GibbsHessian::Exact ); // the final steps of a converged calculation use the exact Hessian
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state1);
+
+            options.hessian = GibbsHessian::PartiallyExact;
+            solver.setOptions(options);
+
+            ChemicalState state2 = state;
+
+            result = solver.solve(state2);
+
+            CHECK( result.succeeded() );
+            CHECK( state1.speciesAmounts().matrix().isApprox(state2.speciesAmounts().matrix(), 1e-6) );
+        }
+
+        WHEN("recording the performance data of the calculations")
+        {
+            options.epsilon = 1e-16;
+            options.trace_size = 2;
+            solver.setOptions(options);
+
+            for(auto i = 0; i < 3; ++i)
+            {
+                ChemicalState state1 = state;
+                result = solver.solve(state1);
+                CHECK( result.succeeded() );
+            }
+
+            const auto records = solver.trace().records();
+
+            REQUIRE( records.size() == 2 );
+            CHECK( solver.trace().count() == 3 );
+            CHECK( records.back().succeeded );
+            CHECK( records.back().iterations == result.iterations() );
+            CHECK( records.back().time > 0.0 );
+            CHECK( records.back().time >= records.back().time_props + records.back().time_hessian );
+        }
+
+        WHEN("using the warm-start cache for cold chemical states")
+        {
+            options.epsilon = 1e-16;
+            options.warmstart_cache_size = 4;
+            solver.setOptions(options);
+
+            const ChemicalState state0 = state; // a chemical state without previous equilibrium solution
+
+            result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() == 27 );
+
+            ChemicalState coldstate = state0;
+
+            result = solver.solve(coldstate); // the previous solution in the warm-start cache is used here
+
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() < 27 );
+            CHECK( coldstate.speciesAmounts().matrix().isApprox(state.speciesAmounts().matrix(), 1e-6) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(coldstate);
+        }
     }
 
     SECTION("There is an aqueous solution and a gaseous solution")
@@ -581,6 +756,50 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
                     { 0.0000000000000000e+00,  0.0000000000000000e+00,  0.0000000000000000e+00 },
                     { 0.0000000000000000e+00,  0.0000000000000000e+00,  0.0000000000000000e+00 }})));
             }
+
+            WHEN("sensitivity derivatives are restricted to some input variables and components")
+            {
+                EquilibriumSensitivity full;
+                solver.solve(state, full, conditions);
+
+                options.sensitivity.inputs = Strings{ "pH" };
+                options.sensitivity.components = Indices{ 0 };
+                solver.setOptions(options);
+
+                EquilibriumSensitivity sensitivity;
+
+                result = solver.solve(state, sensitivity, conditions);
+
+                CHECK( result.succeeded() );
+
+                CHECK( sensitivity.dndw("T").isZero() );
+                CHECK( sensitivity.dndw("P").isZero() );
+                CHECK( sensitivity.dndw("pH").isApprox(full.dndw("pH")) );
+                CHECK( sensitivity.dndc().isApprox(full.dndc()) );
+
+                const auto iT  = 0; // the index of input variable T in w
+                const auto ipH = 2; // the index of input variable pH in w
+
+                CHECK( sensitivity.dudw().col(iT).isZero() );
+                CHECK( sensitivity.dudw().col(ipH).isApprox(full.dudw().col(ipH)) );
+                CHECK( sensitivity.dudc().col(0).isApprox(full.dudc().col(0)) );
+                CHECK( sensitivity.dudc().rightCols(2).isZero() );
+
+                options.sensitivity.chemical_props = false;
+                solver.setOptions(options);
+
+                result = solver.solve(state, sensitivity, conditions);
+
+                CHECK( result.succeeded() );
+                CHECK( sensitivity.dndw("pH").isApprox(full.dndw("pH")) );
+                CHECK( sensitivity.dudw().size() == 0 );
+                CHECK( sensitivity.dudc().size() == 0 );
+
+                options.sensitivity.inputs = Strings{ "V" };
+                CHECK_THROWS( solver.setOptions(options) );
+
+                options.sensitivity = {};
+            }
         }
     }
 
@@ -658,6 +877,110 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
         }
     }
 
+    SECTION("The same EquilibriumSolver object (and its copies) is used for many calculations with different conditions")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+        phases.add( GaseousPhase(speciate("H O C")) );
+
+        ChemicalSystem system(phases);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        EquilibriumConditions conditions(specs);
+
+        ChemicalState state0(system);
+        state0.set("H2O"  , 55.0, "mol");
+        state0.set("NaCl" , 0.10, "mol");
+        state0.set("CO2"  , 1.00, "mol");
+
+        for(auto T : { 25.0, 50.0, 75.0, 50.0 })
+        {
+            conditions.temperature(T, "celsius");
+            conditions.pressure(P, "bar");
+
+            ChemicalState state1(state0);
+            ChemicalState state2(state0);
+
+            EquilibriumSolver copy(solver); // the copy should not refer to the internal data of the original solver
+
+            result = solver.solve(state1, conditions);
+
+            CHECK( result.succeeded() );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state1);
+
+            result = copy.solve(state2, conditions);
+
+            CHECK( result.succeeded() );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state2);
+
+            CHECK( state1.temperature() == Approx(T + 273.15) );
+            CHECK( state2.temperature() == Approx(T + 273.15) );
+            CHECK( state1.speciesAmounts().isApprox(state2.speciesAmounts()) );
+        }
+    }
+
+    SECTION("A batch of chemical states is equilibrated in a single call")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+        phases.add( GaseousPhase(speciate("H O C")) );
+
+        ChemicalSystem system(phases);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        ChemicalState state0(system);
+        state0.temperature(T, "celsius");
+        state0.pressure(P, "bar");
+        state0.set("H2O"  , 55.0, "mol");
+        state0.set("NaCl" , 0.10, "mol");
+        state0.set("CO2"  , 1.00, "mol");
+
+        Vec<ChemicalState> states;
+        Vec<EquilibriumConditions> conditions;
+
+        for(auto i = 0; i < 4; ++i)
+        {
+            EquilibriumConditions cellconditions(specs);
+            cellconditions.temperature(25.0 + 10.0*i, "celsius");
+            cellconditions.pressure(P, "bar");
+
+            states.push_back(state0);
+            conditions.push_back(cellconditions);
+        }
+
+        Vec<EquilibriumResult> results;
+
+        solver.solve(states, conditions, results);
+
+        REQUIRE( results.size() == states.size() );
+
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            ChemicalState state(state0);
+
+            result = solver.solve(state, conditions[i]);
+
+            CHECK( results[i].succeeded() );
+            CHECK( states[i].temperature() == Approx(25.0 + 10.0*i + 273.15) );
+            CHECK( states[i].speciesAmounts().isApprox(state.speciesAmounts()) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(states[i]);
+        }
+
+        CHECK_THROWS( solver.solve(states, Vec<EquilibriumConditions>(1, conditions[0]), results) );
+    }
+
     SECTION("There is an aqueous solution in equilibrium with one or another mineral")
     {
         PhreeqcDatabase db("phreeqc.dat");
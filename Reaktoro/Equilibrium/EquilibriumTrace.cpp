@@ -0,0 +1,233 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumTrace.hpp"
+
+// C++ includes
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The characters at the beginning of a binary file with records of an equilibrium trace.
+const char* binarysignature = "RKTTRACE";
+
+/// Write an unsigned integer into a binary file.
+auto writeUnsigned(std::ofstream& out, std::uint64_t value) -> void
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+/// Write a floating-point number into a binary file.
+auto writeDouble(std::ofstream& out, double value) -> void
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+/// Read an unsigned integer from a binary file.
+auto readUnsigned(std::ifstream& in) -> std::uint64_t
+{
+    std::uint64_t value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+/// Read a floating-point number from a binary file.
+auto readDouble(std::ifstream& in) -> double
+{
+    double value = 0.0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+} // namespace
+
+struct EquilibriumTrace::Impl
+{
+    /// The ring buffer with the records.
+    Vec<EquilibriumTraceRecord> buffer;
+
+    /// The number of records since construction or last clear.
+    Index count = 0;
+
+    Impl()
+    {}
+
+    Impl(Index capacity)
+    : buffer(capacity)
+    {}
+
+    auto record(EquilibriumTraceRecord const& record) -> void
+    {
+        if(buffer.empty())
+            return;
+        buffer[count % buffer.size()] = record;
+        ++count;
+    }
+
+    auto size() const -> Index
+    {
+        return std::min(count, buffer.size());
+    }
+
+    auto records() const -> Vec<EquilibriumTraceRecord>
+    {
+        const auto n = size();
+        Vec<EquilibriumTraceRecord> res;
+        res.reserve(n);
+        for(auto k = count - n; k < count; ++k)
+            res.push_back(buffer[k % buffer.size()]);
+        return res;
+    }
+
+    auto outputCSV(String const& filename) const -> void
+    {
+        std::ofstream out(filename);
+        errorif(!out, "Could not open file `", filename, "` to write the records of an equilibrium trace.");
+        out << "iterations,backtracks,fallback,hessian,succeeded,time,time_props,time_hessian,time_optima\n";
+        out.precision(6);
+        for(auto const& r : records())
+            out << r.iterations << ","
+                << r.backtracks << ","
+                << r.fallback << ","
+                << static_cast<int>(r.hessian) << ","
+                << r.succeeded << ","
+                << r.time << ","
+                << r.time_props << ","
+                << r.time_hessian << ","
+                << r.time_optima << "\n";
+    }
+
+    auto outputBinary(String const& filename) const -> void
+    {
+        std::ofstream out(filename, std::ios::binary);
+        errorif(!out, "Could not open file `", filename, "` to write the records of an equilibrium trace.");
+        const auto recs = records();
+        out.write(binarysignature, std::strlen(binarysignature));
+        writeUnsigned(out, recs.size());
+        for(auto const& r : recs)
+        {
+            writeUnsigned(out, r.iterations);
+            writeUnsigned(out, r.backtracks);
+            writeUnsigned(out, r.fallback);
+            writeUnsigned(out, static_cast<std::uint64_t>(r.hessian));
+            writeUnsigned(out, r.succeeded);
+            writeDouble(out, r.time);
+            writeDouble(out, r.time_props);
+            writeDouble(out, r.time_hessian);
+            writeDouble(out, r.time_optima);
+        }
+    }
+
+    static auto readBinary(String const& filename) -> Vec<EquilibriumTraceRecord>
+    {
+        std::ifstream in(filename, std::ios::binary);
+        errorif(!in, "Could not open file `", filename, "` to read the records of an equilibrium trace.");
+        String signature(std::strlen(binarysignature), ' ');
+        in.read(signature.data(), signature.size());
+        errorif(signature != binarysignature, "The file `", filename, "` does not contain records of an equilibrium trace.");
+        const auto n = readUnsigned(in);
+        Vec<EquilibriumTraceRecord> recs(n);
+        for(auto& r : recs)
+        {
+            r.iterations   = readUnsigned(in);
+            r.backtracks   = readUnsigned(in);
+            r.fallback     = readUnsigned(in);
+            r.hessian      = static_cast<GibbsHessian>(readUnsigned(in));
+            r.succeeded    = readUnsigned(in);
+            r.time         = readDouble(in);
+            r.time_props   = readDouble(in);
+            r.time_hessian = readDouble(in);
+            r.time_optima  = readDouble(in);
+        }
+        errorif(!in, "The file `", filename, "` with records of an equilibrium trace is truncated.");
+        return recs;
+    }
+};
+
+EquilibriumTrace::EquilibriumTrace()
+: pimpl(new Impl())
+{}
+
+EquilibriumTrace::EquilibriumTrace(Index capacity)
+: pimpl(new Impl(capacity))
+{}
+
+EquilibriumTrace::EquilibriumTrace(EquilibriumTrace const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumTrace::~EquilibriumTrace()
+{}
+
+auto EquilibriumTrace::operator=(EquilibriumTrace other) -> EquilibriumTrace&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumTrace::record(EquilibriumTraceRecord const& record) -> void
+{
+    pimpl->record(record);
+}
+
+auto EquilibriumTrace::records() const -> Vec<EquilibriumTraceRecord>
+{
+    return pimpl->records();
+}
+
+auto EquilibriumTrace::size() const -> Index
+{
+    return pimpl->size();
+}
+
+auto EquilibriumTrace::capacity() const -> Index
+{
+    return pimpl->buffer.size();
+}
+
+auto EquilibriumTrace::count() const -> Index
+{
+    return pimpl->count;
+}
+
+auto EquilibriumTrace::clear() -> void
+{
+    pimpl->count = 0;
+}
+
+auto EquilibriumTrace::outputCSV(String const& filename) const -> void
+{
+    pimpl->outputCSV(filename);
+}
+
+auto EquilibriumTrace::outputBinary(String const& filename) const -> void
+{
+    pimpl->outputBinary(filename);
+}
+
+auto EquilibriumTrace::readBinary(String const& filename) -> Vec<EquilibriumTraceRecord>
+{
+    return Impl::readBinary(filename);
+}
+
+} // namespace Reaktoro
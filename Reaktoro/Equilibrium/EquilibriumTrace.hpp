@@ -0,0 +1,119 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+
+namespace Reaktoro {
+
+/// The performance data of a single equilibrium calculation recorded in an EquilibriumTrace object.
+struct EquilibriumTraceRecord
+{
+    /// The number of iterations of the calculation.
+    Index iterations = 0;
+
+    /// The number of evaluations of the chemical properties without evaluation of derivatives (e.g., in backtracking steps of line searches).
+    Index backtracks = 0;
+
+    /// The number of the fallback strategy that produced the result of the calculation (zero if produced by the first attempt).
+    Index fallback = 0;
+
+    /// The calculation mode of the Hessian of the Gibbs energy function at the end of the first attempt of the calculation (the last one chosen if GibbsHessian::Adaptive).
+    GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The flag indicating if the calculation succeeded.
+    bool succeeded = false;
+
+    /// The wall time of the calculation (in s).
+    double time = 0.0;
+
+    /// The time spent evaluating the chemical properties of the system (in s).
+    double time_props = 0.0;
+
+    /// The time spent assembling the Hessian of the Gibbs energy function and other derivatives (in s).
+    double time_hessian = 0.0;
+
+    /// The time spent in the optimization solver other than the above, mostly in the solution of linear systems (in s).
+    double time_optima = 0.0;
+};
+
+/// Used to record the performance data of equilibrium calculations for offline analysis.
+/// The records are kept in a ring buffer of fixed capacity, so that the
+/// oldest ones are overwritten when it is full. Each EquilibriumSolver
+/// object owns its trace (see EquilibriumOptions::trace_size), so that no
+/// locks are needed when recording, even when many solvers run in parallel.
+/// The records can be written to a CSV file or to a compact binary file.
+class EquilibriumTrace
+{
+public:
+    /// Construct a default EquilibriumTrace object (with zero capacity).
+    EquilibriumTrace();
+
+    /// Construct an EquilibriumTrace object with given capacity.
+    explicit EquilibriumTrace(Index capacity);
+
+    /// Construct a copy of an EquilibriumTrace object.
+    EquilibriumTrace(EquilibriumTrace const& other);
+
+    /// Destroy this EquilibriumTrace object.
+    ~EquilibriumTrace();
+
+    /// Assign a copy of an EquilibriumTrace object to this.
+    auto operator=(EquilibriumTrace other) -> EquilibriumTrace&;
+
+    /// Record the performance data of an equilibrium calculation (the oldest record is overwritten if the trace is full).
+    auto record(EquilibriumTraceRecord const& record) -> void;
+
+    /// Return the records in this trace ordered from the oldest to the most recent.
+    auto records() const -> Vec<EquilibriumTraceRecord>;
+
+    /// Return the number of records in this trace.
+    auto size() const -> Index;
+
+    /// Return the maximum number of records in this trace.
+    auto capacity() const -> Index;
+
+    /// Return the number of records since construction or last call to @ref clear (including overwritten ones).
+    auto count() const -> Index;
+
+    /// Remove all records in this trace.
+    auto clear() -> void;
+
+    /// Write the records in this trace to a CSV file (with a header line).
+    auto outputCSV(String const& filename) const -> void;
+
+    /// Write the records in this trace to a binary file.
+    /// The file starts with the characters `RKTTRACE`, followed by the number
+    /// of records as a 64-bit unsigned integer. Each record is then written
+    /// with its integer fields as 64-bit unsigned integers (the Hessian mode
+    /// and success flag included) and its time fields as 64-bit floating-point
+    /// numbers, in the order they are declared in EquilibriumTraceRecord.
+    auto outputBinary(String const& filename) const -> void;
+
+    /// Read the records in a binary file written with @ref outputBinary.
+    static auto readBinary(String const& filename) -> Vec<EquilibriumTraceRecord>;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,53 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumTrace(py::module& m)
+{
+    py::class_<EquilibriumTraceRecord>(m, "EquilibriumTraceRecord")
+        .def(py::init<>())
+        .def_readwrite("iterations", &EquilibriumTraceRecord::iterations)
+        .def_readwrite("backtracks", &EquilibriumTraceRecord::backtracks)
+        .def_readwrite("fallback", &EquilibriumTraceRecord::fallback)
+        .def_readwrite("hessian", &EquilibriumTraceRecord::hessian)
+        .def_readwrite("succeeded", &EquilibriumTraceRecord::succeeded)
+        .def_readwrite("time", &EquilibriumTraceRecord::time)
+        .def_readwrite("time_props", &EquilibriumTraceRecord::time_props)
+        .def_readwrite("time_hessian", &EquilibriumTraceRecord::time_hessian)
+        .def_readwrite("time_optima", &EquilibriumTraceRecord::time_optima)
+        ;
+
+    py::class_<EquilibriumTrace>(m, "EquilibriumTrace")
+        .def(py::init<>())
+        .def(py::init<Index>())
+        .def("record", &EquilibriumTrace::record, "Record the performance data of an equilibrium calculation.")
+        .def("records", &EquilibriumTrace::records, "Return the records in this trace ordered from the oldest to the most recent.")
+        .def("size", &EquilibriumTrace::size, "Return the number of records in this trace.")
+        .def("capacity", &EquilibriumTrace::capacity, "Return the maximum number of records in this trace.")
+        .def("count", &EquilibriumTrace::count, "Return the number of records since construction or last clear (including overwritten ones).")
+        .def("clear", &EquilibriumTrace::clear, "Remove all records in this trace.")
+        .def("outputCSV", &EquilibriumTrace::outputCSV, "Write the records in this trace to a CSV file.")
+        .def("outputBinary", &EquilibriumTrace::outputBinary, "Write the records in this trace to a binary file.")
+        .def_static("readBinary", &EquilibriumTrace::readBinary, "Read the records in a binary file written with outputBinary.")
+        ;
+}
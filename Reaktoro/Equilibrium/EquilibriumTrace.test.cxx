@@ -0,0 +1,125 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumTrace.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return an EquilibriumTraceRecord object with given number of iterations.
+auto createRecord(Index iterations) -> EquilibriumTraceRecord
+{
+    EquilibriumTraceRecord record;
+    record.iterations = iterations;
+    record.backtracks = 2 * iterations;
+    record.fallback = iterations % 2;
+    record.hessian = GibbsHessian::Exact;
+    record.succeeded = true;
+    record.time = 0.1 * iterations;
+    record.time_props = 0.01 * iterations;
+    record.time_hessian = 0.02 * iterations;
+    record.time_optima = 0.07 * iterations;
+    return record;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Testing EquilibriumTrace", "[EquilibriumTrace]")
+{
+    EquilibriumTrace trace(3);
+
+    CHECK( trace.size() == 0 );
+    CHECK( trace.capacity() == 3 );
+
+    SECTION("Checking the ring buffer of records")
+    {
+        trace.record(createRecord(1));
+        trace.record(createRecord(2));
+
+        CHECK( trace.size() == 2 );
+        CHECK( trace.records()[0].iterations == 1 );
+        CHECK( trace.records()[1].iterations == 2 );
+
+        trace.record(createRecord(3));
+        trace.record(createRecord(4)); // the oldest record is overwritten here
+
+        const auto records = trace.records();
+
+        CHECK( trace.size() == 3 );
+        CHECK( trace.count() == 4 );
+        CHECK( records[0].iterations == 2 );
+        CHECK( records[1].iterations == 3 );
+        CHECK( records[2].iterations == 4 );
+
+        trace.clear();
+
+        CHECK( trace.size() == 0 );
+        CHECK( trace.count() == 0 );
+    }
+
+    SECTION("Checking a trace with zero capacity")
+    {
+        EquilibriumTrace trace;
+
+        trace.record(createRecord(1));
+
+        CHECK( trace.size() == 0 );
+        CHECK( trace.records().empty() );
+    }
+
+    SECTION("Checking the output of the records to files")
+    {
+        trace.record(createRecord(1));
+        trace.record(createRecord(2));
+
+        trace.outputBinary("equilibrium-trace.bin");
+
+        const auto records = EquilibriumTrace::readBinary("equilibrium-trace.bin");
+
+        REQUIRE( records.size() == 2 );
+        CHECK( records[1].iterations   == 2 );
+        CHECK( records[1].backtracks   == 4 );
+        CHECK( records[1].fallback     == 0 );
+        CHECK( records[1].hessian      == GibbsHessian::Exact );
+        CHECK( records[1].succeeded    == true );
+        CHECK( records[1].time         == 0.2 );
+        CHECK( records[1].time_props   == 0.02 );
+        CHECK( records[1].time_hessian == 0.04 );
+        CHECK( records[1].time_optima  == 0.07 * 2 );
+
+        trace.outputCSV("equilibrium-trace.csv");
+
+        std::ifstream file("equilibrium-trace.csv");
+        String line;
+        auto numlines = 0;
+        while(std::getline(file, line))
+            ++numlines;
+
+        CHECK( numlines == 3 ); // the header line and two records
+
+        std::remove("equilibrium-trace.bin");
+        std::remove("equilibrium-trace.csv");
+    }
+}
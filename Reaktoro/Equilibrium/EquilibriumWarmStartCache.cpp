@@ -0,0 +1,206 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumWarmStartCache.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <list>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+struct EquilibriumWarmStartCache::Impl
+{
+    /// A stored solution of an equilibrium calculation and its conditions.
+    struct Entry
+    {
+        Vec<long> key;       ///< The discretized conditions of the calculation.
+        double T;            ///< The temperature of the calculation (in K).
+        double P;            ///< The pressure of the calculation (in Pa).
+        ArrayXd c;           ///< The amounts of the conservative components in the calculation (in mol).
+        Optima::State state; ///< The solution of the calculation.
+    };
+
+    /// The maximum number of stored solutions.
+    Index capacity = 0;
+
+    /// The relative resolution used to discretize the conditions of the calculations.
+    double resolution = 1e-3;
+
+    /// The stored solutions ordered from the most to the least recently used.
+    std::list<Entry> entries;
+
+    /// The discretized conditions (workspace).
+    Vec<long> key;
+
+    Impl()
+    {}
+
+    Impl(Index capacity, double resolution)
+    : capacity(capacity), resolution(resolution)
+    {
+        errorif(resolution <= 0.0, "The resolution of the warm-start cache must be positive, but got ", resolution, ".");
+    }
+
+    /// Return the discretized value of `v` on a logarithmic scale (the sign of `v` is kept).
+    auto discretize(double v) const -> long
+    {
+        const auto tiny = 1e-30; // values below this are considered zero
+        const auto a = std::abs(v);
+        if(a <= tiny)
+            return 0;
+        const auto k = 1 + std::lround(std::log(a/tiny) / std::log1p(resolution));
+        return v > 0.0 ? k : -k;
+    }
+
+    /// Update the workspace `key` with the discretized conditions.
+    auto updateKey(double T, double P, ArrayXdConstRef c) -> void
+    {
+        key.resize(2 + c.size());
+        key[0] = discretize(T);
+        key[1] = discretize(P);
+        for(auto i = 0; i < c.size(); ++i)
+            key[2 + i] = discretize(c[i]);
+    }
+
+    /// Return the squared relative distance between the conditions of a stored solution and given ones.
+    static auto distance(Entry const& entry, double T, double P, ArrayXdConstRef c) -> double
+    {
+        auto reldiff = [](double a, double b)
+        {
+            const auto scale = std::max({ std::abs(a), std::abs(b), 1e-16 });
+            return (a - b)/scale;
+        };
+
+        auto res = std::pow(reldiff(entry.T, T), 2) + std::pow(reldiff(entry.P, P), 2);
+        for(auto i = 0; i < c.size(); ++i)
+            res += std::pow(reldiff(entry.c[i], c[i]), 2);
+        return res;
+    }
+
+    auto store(double T, double P, ArrayXdConstRef c, Optima::State const& state) -> void
+    {
+        if(capacity == 0)
+            return;
+
+        updateKey(T, P, c);
+
+        auto it = std::find_if(entries.begin(), entries.end(), [&](Entry const& entry) { return entry.key == key; });
+
+        if(it != entries.end())
+        {
+            it->T = T;
+            it->P = P;
+            it->c = c;
+            it->state = state;
+            entries.splice(entries.begin(), entries, it);
+            return;
+        }
+
+        if(entries.size() == capacity)
+            entries.pop_back();
+
+        entries.push_front({ key, T, P, c, state });
+    }
+
+    auto nearest(double T, double P, ArrayXdConstRef c, Optima::State& state) -> bool
+    {
+        auto best = entries.end();
+        auto bestdistance = 0.0;
+
+        for(auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if(it->c.size() != c.size())
+                continue;
+            const auto d = distance(*it, T, P, c);
+            if(best == entries.end() || d < bestdistance)
+            {
+                best = it;
+                bestdistance = d;
+            }
+        }
+
+        if(best == entries.end())
+            return false;
+
+        entries.splice(entries.begin(), entries, best);
+
+        state = best->state;
+
+        return true;
+    }
+};
+
+EquilibriumWarmStartCache::EquilibriumWarmStartCache()
+: pimpl(new Impl())
+{}
+
+EquilibriumWarmStartCache::EquilibriumWarmStartCache(Index capacity, double resolution)
+: pimpl(new Impl(capacity, resolution))
+{}
+
+EquilibriumWarmStartCache::EquilibriumWarmStartCache(EquilibriumWarmStartCache const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumWarmStartCache::~EquilibriumWarmStartCache()
+{}
+
+auto EquilibriumWarmStartCache::operator=(EquilibriumWarmStartCache other) -> EquilibriumWarmStartCache&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumWarmStartCache::store(double T, double P, ArrayXdConstRef c, Optima::State const& state) -> void
+{
+    pimpl->store(T, P, c, state);
+}
+
+auto EquilibriumWarmStartCache::nearest(double T, double P, ArrayXdConstRef c, Optima::State& state) -> bool
+{
+    return pimpl->nearest(T, P, c, state);
+}
+
+auto EquilibriumWarmStartCache::size() const -> Index
+{
+    return pimpl->entries.size();
+}
+
+auto EquilibriumWarmStartCache::capacity() const -> Index
+{
+    return pimpl->capacity;
+}
+
+auto EquilibriumWarmStartCache::resolution() const -> double
+{
+    return pimpl->resolution;
+}
+
+auto EquilibriumWarmStartCache::clear() -> void
+{
+    pimpl->entries.clear();
+}
+
+} // namespace Reaktoro
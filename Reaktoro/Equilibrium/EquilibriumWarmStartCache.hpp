@@ -0,0 +1,92 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+// Forward declarations (Optima)
+namespace Optima { class State; }
+
+namespace Reaktoro {
+
+/// Used to store solutions of previous equilibrium calculations to warm-start new calculations from cold chemical states.
+/// Each stored solution (an Optima::State object with primal and dual
+/// variables, and the partition of stable and unstable variables) is
+/// associated with the temperature, pressure and amounts of conservative
+/// components of its calculation. These conditions are discretized with a
+/// relative resolution so that the solutions of calculations with practically
+/// the same conditions are stored only once. When the cache is full, the least
+/// recently used solution is discarded.
+class EquilibriumWarmStartCache
+{
+public:
+    /// Construct a default EquilibriumWarmStartCache object (with zero capacity).
+    EquilibriumWarmStartCache();
+
+    /// Construct an EquilibriumWarmStartCache object.
+    /// @param capacity The maximum number of stored solutions
+    /// @param resolution The relative resolution used to discretize temperature, pressure and amounts of conservative components
+    EquilibriumWarmStartCache(Index capacity, double resolution);
+
+    /// Construct a copy of an EquilibriumWarmStartCache object.
+    EquilibriumWarmStartCache(EquilibriumWarmStartCache const& other);
+
+    /// Destroy this EquilibriumWarmStartCache object.
+    ~EquilibriumWarmStartCache();
+
+    /// Assign a copy of an EquilibriumWarmStartCache object to this.
+    auto operator=(EquilibriumWarmStartCache other) -> EquilibriumWarmStartCache&;
+
+    /// Store the solution of an equilibrium calculation.
+    /// If a solution with the same discretized conditions already exists, it is replaced.
+    /// @param T The temperature of the calculation (in K)
+    /// @param P The pressure of the calculation (in Pa)
+    /// @param c The amounts of the conservative components in the calculation (in mol)
+    /// @param state The solution of the calculation
+    auto store(double T, double P, ArrayXdConstRef c, Optima::State const& state) -> void;
+
+    /// Find the stored solution whose conditions are the nearest to given ones.
+    /// The found solution becomes the most recently used one.
+    /// @param T The temperature of the calculation (in K)
+    /// @param P The pressure of the calculation (in Pa)
+    /// @param c The amounts of the conservative components in the calculation (in mol)
+    /// @param[out] state The found solution
+    /// @return false if there is no stored solution, true otherwise
+    auto nearest(double T, double P, ArrayXdConstRef c, Optima::State& state) -> bool;
+
+    /// Return the number of stored solutions.
+    auto size() const -> Index;
+
+    /// Return the maximum number of stored solutions.
+    auto capacity() const -> Index;
+
+    /// Return the relative resolution used to discretize temperature, pressure and amounts of conservative components.
+    auto resolution() const -> double;
+
+    /// Remove all stored solutions.
+    auto clear() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,120 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumWarmStartCache.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return an Optima::State object whose primal variables are all equal to given value.
+auto createOptimaState(double value) -> Optima::State
+{
+    Optima::Dims dims;
+    dims.x = 3;
+    dims.be = 2;
+
+    Optima::State state(dims);
+    state.x.fill(value);
+
+    return state;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Testing EquilibriumWarmStartCache", "[EquilibriumWarmStartCache]")
+{
+    EquilibriumWarmStartCache cache(2, 1e-3);
+
+    const auto T = 300.0;
+    const auto P = 1.0e5;
+
+    const ArrayXd c1 = ArrayXd{{ 1.0, 2.0 }};
+    const ArrayXd c2 = ArrayXd{{ 5.0, 2.0 }};
+    const ArrayXd c3 = ArrayXd{{ 9.0, 2.0 }};
+
+    Optima::State state = createOptimaState(0.0);
+
+    SECTION("Checking an empty cache")
+    {
+        CHECK( cache.size() == 0 );
+        CHECK( cache.capacity() == 2 );
+        CHECK( cache.nearest(T, P, c1, state) == false );
+    }
+
+    SECTION("Checking the search of the nearest solution")
+    {
+        cache.store(T, P, c1, createOptimaState(1.0));
+        cache.store(T, P, c2, createOptimaState(2.0));
+
+        CHECK( cache.size() == 2 );
+
+        CHECK( cache.nearest(T, P, ArrayXd{{ 1.1, 2.0 }}, state) );
+        CHECK( state.x[0] == 1.0 );
+
+        CHECK( cache.nearest(T, P, ArrayXd{{ 4.0, 2.0 }}, state) );
+        CHECK( state.x[0] == 2.0 );
+
+        CHECK( cache.nearest(T + 1.0, P, c1, state) );
+        CHECK( state.x[0] == 1.0 );
+    }
+
+    SECTION("Checking that solutions with the same discretized conditions are stored once")
+    {
+        cache.store(T, P, c1, createOptimaState(1.0));
+        cache.store(T * (1 + 1e-6), P, c1, createOptimaState(2.0));
+
+        CHECK( cache.size() == 1 );
+        CHECK( cache.nearest(T, P, c1, state) );
+        CHECK( state.x[0] == 2.0 ); // the most recent solution is kept
+    }
+
+    SECTION("Checking that the least recently used solution is discarded")
+    {
+        cache.store(T, P, c1, createOptimaState(1.0));
+        cache.store(T, P, c2, createOptimaState(2.0));
+
+        CHECK( cache.nearest(T, P, c1, state) ); // the solution with c1 becomes the most recently used one
+
+        cache.store(T, P, c3, createOptimaState(3.0)); // the solution with c2 is discarded
+
+        CHECK( cache.size() == 2 );
+
+        CHECK( cache.nearest(T, P, c2, state) );
+        CHECK( state.x[0] != 2.0 );
+
+        cache.clear();
+
+        CHECK( cache.size() == 0 );
+    }
+
+    SECTION("Checking a cache with zero capacity")
+    {
+        EquilibriumWarmStartCache cache;
+
+        cache.store(T, P, c1, createOptimaState(1.0));
+
+        CHECK( cache.size() == 0 );
+        CHECK( cache.nearest(T, P, c1, state) == false );
+    }
+}
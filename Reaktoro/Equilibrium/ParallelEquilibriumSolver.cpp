@@ -0,0 +1,259 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ParallelEquilibriumSolver.hpp"
+
+// C++ includes
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+
+struct ParallelEquilibriumSolver::Impl
+{
+    /// The chemical equilibrium specifications shared by all workers.
+    const EquilibriumSpecs specs;
+
+    /// The options of the equilibrium solvers of all workers.
+    EquilibriumOptions options;
+
+    /// The equilibrium solvers of the workers (the first one is used by the calling thread).
+    Vec<EquilibriumSolver> solvers;
+
+    /// The threads of the workers other than the calling thread.
+    Vec<std::thread> threads;
+
+    /// The mutex used to synchronize the calling thread with the worker threads.
+    std::mutex mutex;
+
+    /// The condition variable used to notify the worker threads of a new batch of tasks (or of stopping).
+    std::condition_variable cvstart;
+
+    /// The condition variable used to notify the calling thread that all worker threads are done.
+    std::condition_variable cvdone;
+
+    /// The task to be performed on the i-th item of the current batch using the equilibrium solver of a worker.
+    Fn<void(EquilibriumSolver&, Index)> task;
+
+    /// The number of items in the current batch.
+    Index numtasks = 0;
+
+    /// The index of the next item in the current batch to be processed by the first available worker.
+    std::atomic<Index> inext{0};
+
+    /// The counter of batches submitted to the worker threads so far.
+    Index batch = 0;
+
+    /// The number of worker threads still processing the current batch.
+    Index numbusy = 0;
+
+    /// The flag that indicates the worker threads should terminate.
+    bool stopping = false;
+
+    /// The first exception thrown by a worker while processing the current batch.
+    std::exception_ptr exception;
+
+    /// Construct a ParallelEquilibriumSolver::Impl object.
+    Impl(EquilibriumSpecs const& specs, Index numthreads)
+    : specs(specs)
+    {
+        numthreads = numthreads > 0 ? numthreads : std::max<Index>(1, std::thread::hardware_concurrency());
+
+        // Each worker owns its EquilibriumSolver object (and thus its Optima problem, state, and workspace).
+        // The ChemicalSystem object is shared among them as a read-only object. Its models keep mutable caches
+        // and workspaces per thread (see memoizeLast and ThreadLocal), so no synchronization is needed here.
+        solvers.reserve(numthreads);
+        for(auto i = 0; i < numthreads; ++i)
+            solvers.emplace_back(specs);
+
+        threads.reserve(numthreads - 1);
+        for(auto i = 1; i < numthreads; ++i)
+            threads.emplace_back([this, i] { loop(i); });
+    }
+
+    /// Destroy this ParallelEquilibriumSolver::Impl object.
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvstart.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    /// The main loop of a worker thread, which processes a batch every time one is submitted.
+    auto loop(Index iworker) -> void
+    {
+        Index lastbatch = 0;
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvstart.wait(lock, [&] { return stopping || batch != lastbatch; });
+            if(stopping)
+                return;
+            lastbatch = batch;
+            lock.unlock();
+
+            work(iworker);
+
+            lock.lock();
+            if(--numbusy == 0)
+                cvdone.notify_one();
+        }
+    }
+
+    /// Process the items of the current batch until there are no more items left.
+    auto work(Index iworker) -> void
+    {
+        auto& solver = solvers[iworker];
+        for(auto i = inext++; i < numtasks; i = inext++)
+        {
+            try { task(solver, i); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!exception)
+                    exception = std::current_exception();
+                inext = numtasks; // no need to process remaining items after a failure
+            }
+        }
+    }
+
+    /// Perform a task on each item of a batch using all workers, including the calling thread.
+    auto run(Index size, Fn<void(EquilibriumSolver&, Index)> const& fn) -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = fn;
+            numtasks = size;
+            inext = 0;
+            numbusy = threads.size();
+            exception = nullptr;
+            ++batch;
+        }
+
+        cvstart.notify_all();
+
+        work(0);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvdone.wait(lock, [&] { return numbusy == 0; });
+        }
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    auto setOptions(EquilibriumOptions const& opts) -> void
+    {
+        options = opts;
+        for(auto& solver : solvers)
+            solver.setOptions(options);
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void
+    {
+        results.resize(states.size());
+        run(states.size(), [&](EquilibriumSolver& solver, Index i) {
+            results[i] = solver.solve(states[i]);
+        });
+    }
+
+    auto solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void
+    {
+        results.resize(states.size());
+        run(states.size(), [&](EquilibriumSolver& solver, Index i) {
+            results[i] = solver.solve(states[i], conditions);
+        });
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void
+    {
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects "
+            "when equilibrating a batch of chemical states, but got ", states.size(), " and ", conditions.size(), " instead.");
+        results.resize(states.size());
+        run(states.size(), [&](EquilibriumSolver& solver, Index i) {
+            results[i] = solver.solve(states[i], conditions[i]);
+        });
+    }
+};
+
+ParallelEquilibriumSolver::ParallelEquilibriumSolver(ChemicalSystem const& system, Index numthreads)
+: pimpl(new Impl(EquilibriumSpecs::TP(system), numthreads))
+{}
+
+ParallelEquilibriumSolver::ParallelEquilibriumSolver(EquilibriumSpecs const& specs, Index numthreads)
+: pimpl(new Impl(specs, numthreads))
+{}
+
+ParallelEquilibriumSolver::ParallelEquilibriumSolver(ParallelEquilibriumSolver const& other)
+: pimpl(new Impl(other.pimpl->specs, other.pimpl->solvers.size()))
+{
+    pimpl->setOptions(other.pimpl->options);
+}
+
+ParallelEquilibriumSolver::~ParallelEquilibriumSolver()
+{}
+
+auto ParallelEquilibriumSolver::operator=(ParallelEquilibriumSolver other) -> ParallelEquilibriumSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ParallelEquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, results);
+}
+
+auto ParallelEquilibriumSolver::solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, conditions, results);
+}
+
+auto ParallelEquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void
+{
+    pimpl->solve(states, conditions, results);
+}
+
+auto ParallelEquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto ParallelEquilibriumSolver::numThreads() const -> Index
+{
+    return pimpl->solvers.size();
+}
+
+} // namespace Reaktoro
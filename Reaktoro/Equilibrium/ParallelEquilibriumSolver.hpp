@@ -0,0 +1,89 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+class EquilibriumConditions;
+class EquilibriumSpecs;
+struct EquilibriumOptions;
+struct EquilibriumResult;
+
+/// Used for calculating chemical equilibrium states of many independent cells using multiple threads.
+/// This class keeps a pool of worker threads, each one with its own
+/// EquilibriumSolver object, that share the same read-only ChemicalSystem
+/// object. The chemical states in a batch are dynamically distributed among
+/// the workers, with the calling thread acting as one of them.
+class ParallelEquilibriumSolver
+{
+public:
+    /// Construct a ParallelEquilibriumSolver object with given chemical system.
+    /// @param system The chemical system shared by all worker threads
+    /// @param numthreads The number of worker threads (if zero, the number of hardware threads is used)
+    explicit ParallelEquilibriumSolver(ChemicalSystem const& system, Index numthreads = 0);
+
+    /// Construct a ParallelEquilibriumSolver object with given chemical equilibrium specifications.
+    /// @param specs The chemical equilibrium specifications shared by all worker threads
+    /// @param numthreads The number of worker threads (if zero, the number of hardware threads is used)
+    explicit ParallelEquilibriumSolver(EquilibriumSpecs const& specs, Index numthreads = 0);
+
+    /// Construct a copy of a ParallelEquilibriumSolver object (the copy has its own pool of worker threads).
+    ParallelEquilibriumSolver(ParallelEquilibriumSolver const& other);
+
+    /// Destroy this ParallelEquilibriumSolver object.
+    ~ParallelEquilibriumSolver();
+
+    /// Assign a copy of a ParallelEquilibriumSolver object to this.
+    auto operator=(ParallelEquilibriumSolver other) -> ParallelEquilibriumSolver&;
+
+    /// Equilibrate a batch of chemical states in parallel.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumResult>& results) -> void;
+
+    /// Equilibrate a batch of chemical states in parallel respecting the same given constraint conditions.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for every chemical state
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, EquilibriumConditions const& conditions, Vec<EquilibriumResult>& results) -> void;
+
+    /// Equilibrate a batch of chemical states in parallel respecting given constraint conditions for each of them.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium, one for each chemical state
+    /// @param[out] results The results of the equilibrium calculations, one for each chemical state (resized if needed)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, Vec<EquilibriumResult>& results) -> void;
+
+    /// Set the options of the equilibrium solvers of all worker threads.
+    auto setOptions(EquilibriumOptions const& options) -> void;
+
+    /// Return the number of worker threads (including the calling thread).
+    auto numThreads() const -> Index;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,111 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/ParallelEquilibriumSolver.hpp>
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelCubicEOS.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ParallelEquilibriumSolver", "[ParallelEquilibriumSolver]")
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    AqueousPhase aqueousphase(speciate("H O C Na Cl Ca Mg"));
+    aqueousphase.set(ActivityModelDavies());
+
+    GaseousPhase gaseousphase("H2O(g) CO2(g)");
+    gaseousphase.set(ActivityModelPengRobinson());
+
+    ChemicalSystem system(db, aqueousphase, gaseousphase, MineralPhase("Calcite"));
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    EquilibriumOptions options;
+    options.optima.backtracksearch.apply_min_max_fix_and_accept = true;
+
+    ChemicalState state0(system);
+    state0.set("H2O"    , 1.0, "kg");
+    state0.set("Na+"    , 0.5, "mol");
+    state0.set("Cl-"    , 0.5, "mol");
+    state0.set("CO2(g)" , 0.2, "mol");
+    state0.set("Calcite", 1.0, "mol");
+
+    const auto numcells = 40;
+
+    Vec<ChemicalState> states(numcells, state0);
+    Vec<EquilibriumConditions> conditions;
+
+    for(auto i = 0; i < numcells; ++i)
+    {
+        EquilibriumConditions cellconditions(specs);
+        cellconditions.temperature(25.0 + 2.0*i, "celsius");
+        cellconditions.pressure(1.0 + 5.0*i, "bar");
+        conditions.push_back(cellconditions);
+    }
+
+    ParallelEquilibriumSolver solver(specs, 4);
+    solver.setOptions(options);
+
+    CHECK( solver.numThreads() == 4 );
+
+    Vec<EquilibriumResult> results;
+
+    solver.solve(states, conditions, results);
+
+    REQUIRE( results.size() == numcells );
+
+    // Compare the states computed in parallel with those computed serially
+    EquilibriumSolver serialsolver(specs);
+    serialsolver.setOptions(options);
+
+    for(auto i = 0; i < numcells; ++i)
+    {
+        ChemicalState state(state0);
+        serialsolver.solve(state, conditions[i]);
+
+        CHECK( results[i].succeeded() );
+        CHECK( states[i].temperature() == Approx(25.0 + 2.0*i + 273.15) );
+        CHECK( states[i].speciesAmounts().isApprox(state.speciesAmounts()) );
+    }
+
+    // Check that a copy of the solver (with its own worker threads) produces the same states
+    ParallelEquilibriumSolver solvercopy(solver);
+
+    Vec<ChemicalState> statescopy(numcells, state0);
+
+    solvercopy.solve(statescopy, conditions, results);
+
+    for(auto i = 0; i < numcells; ++i)
+        CHECK( statescopy[i].speciesAmounts().isApprox(states[i].speciesAmounts()) );
+
+    CHECK_THROWS( solver.solve(states, Vec<EquilibriumConditions>(1, conditions[0]), results) );
+}
@@ -53,6 +53,40 @@ struct SmartEquilibriumOptions
 
     /// The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).
     double pressure_step = 25.0e+5;
+
+    /// The flag indicating if the sensitivity derivatives in the learned records are stored with single precision.
+    /// The sensitivity derivatives dominate the memory used by each record
+    /// in the knowledge database. Storing them as 32-bit floating-point
+    /// numbers halves this memory at the cost of first-order Taylor
+    /// predictions with about seven significant digits in their increments.
+    bool single_precision_sensitivity = false;
+
+    /// The number of records nearest to the new conditions that are tested first in each cluster when searching for a prediction (zero to disable).
+    /// The nearest records are found using a k-d tree over the input variables
+    /// and initial component amounts *z* = (*w*, *c*) of the records in each
+    /// cluster, with each entry of *z* normalized by its value in the first
+    /// record of the cluster.
+    Index nearest_records = 4;
+
+    /// The flag indicating if only the nearest records are tested in each cluster when searching for a prediction.
+    /// If false, the remaining records in the cluster are tested next in the order
+    /// of their usage counts. If true, the cost of searching a cluster grows
+    /// logarithmically with its number of records, but a valid record that is
+    /// not among the nearest ones can be missed.
+    bool nearest_records_only = false;
+
+    /// The maximum number of records in the knowledge database (zero for no limit).
+    /// When a new record is learned and this limit would be exceeded, the least
+    /// frequently used records (those with the smallest usage counts in the
+    /// priority queues of their clusters) are evicted first. Clusters and
+    /// temperature-pressure grid cells left without records are also removed.
+    Index max_records = 0;
+
+    /// The maximum memory used by the records in the knowledge database (in bytes, zero for no limit).
+    /// The memory considered is the one of the records themselves (see SmartEquilibriumSolver::Record::memory),
+    /// which dominates the memory of the knowledge database. The least frequently used records are evicted first.
+    /// A learned record whose memory alone exceeds this limit is not stored, and no record is evicted for it.
+    Index max_memory = 0;
 };
 
 } // namespace Reaktoro
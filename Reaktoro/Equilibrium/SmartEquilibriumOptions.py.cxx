@@ -30,6 +30,11 @@ void exportSmartEquilibriumOptions(py::module& m)
         .def_readwrite("reltol_negative_amounts", &SmartEquilibriumOptions::reltol_negative_amounts, "The relative tolerance for negative species amounts when predicting with first-order Taylor approximation.")
         .def_readwrite("reltol", &SmartEquilibriumOptions::reltol, "The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.")
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol, "The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.")
+        .def_readwrite("single_precision_sensitivity", &SmartEquilibriumOptions::single_precision_sensitivity, "The flag indicating if the sensitivity derivatives in the learned records are stored with single precision.")
+        .def_readwrite("nearest_records", &SmartEquilibriumOptions::nearest_records, "The number of records nearest to the new conditions that are tested first in each cluster when searching for a prediction (zero to disable).")
+        .def_readwrite("nearest_records_only", &SmartEquilibriumOptions::nearest_records_only, "The flag indicating if only the nearest records are tested in each cluster when searching for a prediction.")
+        .def_readwrite("max_records", &SmartEquilibriumOptions::max_records, "The maximum number of records in the knowledge database (zero for no limit).")
+        .def_readwrite("max_memory", &SmartEquilibriumOptions::max_memory, "The maximum memory used by the records in the knowledge database (in bytes, zero for no limit).")
         ;
 }
 
@@ -50,6 +50,9 @@ auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumRe
 auto SmartEquilibriumResultDuringLearning::operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&
 {
     solve +=other.solve;
+    evicted_records += other.evicted_records;
+    evicted_clusters += other.evicted_clusters;
+    discarded_records += other.discarded_records;
 
     return *this;
 }
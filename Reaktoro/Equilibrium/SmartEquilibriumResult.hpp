@@ -93,6 +93,15 @@ struct SmartEquilibriumResultDuringLearning
     /// The result of the conventional iterative chemical equilibrium calculation in the learning operation.
     EquilibriumResult solve;
 
+    /// The number of least frequently used records evicted from the knowledge database to respect its limits.
+    Index evicted_records = 0;
+
+    /// The number of clusters removed from the knowledge database because all their records were evicted.
+    Index evicted_clusters = 0;
+
+    /// The number of learned records not stored because each alone exceeds the memory limit of the knowledge database.
+    Index discarded_records = 0;
+
     /// Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&;
 };
@@ -53,6 +53,9 @@ void exportSmartEquilibriumResult(py::module& m)
     py::class_<SmartEquilibriumResultDuringLearning>(m, "SmartEquilibriumResultDuringLearning")
         .def(py::init<>())
         .def_readwrite("solve", &SmartEquilibriumResultDuringLearning::solve)
+        .def_readwrite("evicted_records", &SmartEquilibriumResultDuringLearning::evicted_records)
+        .def_readwrite("evicted_clusters", &SmartEquilibriumResultDuringLearning::evicted_clusters)
+        .def_readwrite("discarded_records", &SmartEquilibriumResultDuringLearning::discarded_records)
         .def(py::self += py::self)
         ;
 
@@ -17,14 +17,25 @@
 
 #include "SmartEquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+// Optima includes
+#include <Optima/State.hpp>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
@@ -45,10 +56,216 @@ auto sround(double num, double step) -> long
     return round(num / step) * step;
 }
 
+/// Return the memory used by the coefficients of an Eigen matrix or array (in bytes).
+template<typename T>
+auto memory(Eigen::DenseBase<T> const& mat) -> Index
+{
+    return mat.size() * sizeof(typename T::Scalar);
+}
+
+/// Set a column of a matrix whose number of columns is increased geometrically when needed.
+/// @param mat The matrix whose first columns are in use
+/// @param icol The index of the column to be set (equal to the number of columns in use)
+/// @param col The values of the new column
+auto setColumnWithCapacity(MatrixXd& mat, Index icol, VectorXdConstRef col) -> void
+{
+    if(icol >= mat.cols())
+        mat.conservativeResize(col.size(), std::max<Index>(2 * mat.cols(), 8));
+    mat.col(icol) = col;
+}
+
+/// Remove a column of a matrix whose first columns are in use, shifting the next columns in use to the left.
+/// @param mat The matrix whose first columns are in use
+/// @param icol The index of the column to be removed
+/// @param ncols The number of columns in use
+auto removeColumn(MatrixXd& mat, Index icol, Index ncols) -> void
+{
+    for(auto j = icol; j + 1 < ncols; ++j)
+        mat.col(j) = mat.col(j + 1);
+}
+
+/// The characters at the beginning of a binary file with the knowledge database of a smart equilibrium solver.
+const char* binarysignature = "RKTSMART";
+
+/// The version of the format of the binary file with the knowledge database of a smart equilibrium solver.
+const std::uint64_t binaryversion = 2;
+
+/// Write an unsigned integer into a binary file.
+auto writeUnsigned(std::ofstream& out, std::uint64_t value) -> void
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+/// Write a signed integer into a binary file.
+auto writeSigned(std::ofstream& out, std::int64_t value) -> void
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+/// Write a floating-point number into a binary file.
+auto writeDouble(std::ofstream& out, double value) -> void
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+/// Write zero bytes into a binary file so that the written data of given size ends at a multiple of 8 bytes.
+auto writePadding(std::ofstream& out, Index size) -> void
+{
+    const char zeros[8] = {};
+    out.write(zeros, (8 - size % 8) % 8);
+}
+
+/// Write a string into a binary file (its length followed by its characters and padding).
+auto writeString(std::ofstream& out, String const& str) -> void
+{
+    writeUnsigned(out, str.size());
+    out.write(str.data(), str.size());
+    writePadding(out, str.size());
+}
+
+/// Write a list of strings into a binary file.
+auto writeStrings(std::ofstream& out, Strings const& strs) -> void
+{
+    writeUnsigned(out, strs.size());
+    for(auto const& str : strs)
+        writeString(out, str);
+}
+
+/// Write a list of indices into a binary file.
+auto writeIndices(std::ofstream& out, Deque<Index> const& indices) -> void
+{
+    writeUnsigned(out, indices.size());
+    for(auto i : indices)
+        writeUnsigned(out, i);
+}
+
+/// Write an Eigen matrix or array into a binary file (its dimensions followed by its coefficients in column-major order and padding).
+template<typename T>
+auto writeArray(std::ofstream& out, Eigen::DenseBase<T> const& mat) -> void
+{
+    using Scalar = typename T::Scalar;
+    const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> values = mat;
+    writeUnsigned(out, values.rows());
+    writeUnsigned(out, values.cols());
+    out.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(Scalar));
+    writePadding(out, values.size() * sizeof(Scalar));
+}
+
+/// Write a priority queue into a binary file.
+auto writePriorityQueue(std::ofstream& out, PriorityQueue const& queue) -> void
+{
+    writeIndices(out, queue.priorities());
+    writeIndices(out, queue.order());
+}
+
+/// Read an unsigned integer from a binary file.
+auto readUnsigned(std::ifstream& in) -> std::uint64_t
+{
+    std::uint64_t value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+/// Read a signed integer from a binary file.
+auto readSigned(std::ifstream& in) -> std::int64_t
+{
+    std::int64_t value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+/// Read a floating-point number from a binary file.
+auto readDouble(std::ifstream& in) -> double
+{
+    double value = 0.0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+/// Skip the padding bytes in a binary file after read data of given size.
+auto readPadding(std::ifstream& in, Index size) -> void
+{
+    in.ignore((8 - size % 8) % 8);
+}
+
+/// Read a string from a binary file.
+auto readString(std::ifstream& in) -> String
+{
+    String str(readUnsigned(in), ' ');
+    in.read(str.data(), str.size());
+    readPadding(in, str.size());
+    return str;
+}
+
+/// Read a list of strings from a binary file.
+auto readStrings(std::ifstream& in) -> Strings
+{
+    Strings strs(readUnsigned(in));
+    for(auto& str : strs)
+        str = readString(in);
+    return strs;
+}
+
+/// Read a list of indices from a binary file.
+auto readIndices(std::ifstream& in) -> Deque<Index>
+{
+    Deque<Index> indices(readUnsigned(in));
+    for(auto& i : indices)
+        i = readUnsigned(in);
+    return indices;
+}
+
+/// Read an Eigen matrix or array from a binary file.
+template<typename T>
+auto readArray(std::ifstream& in, Eigen::PlainObjectBase<T>& mat) -> void
+{
+    using Scalar = typename T::Scalar;
+    const auto rows = readUnsigned(in);
+    const auto cols = readUnsigned(in);
+    mat.resize(rows, cols);
+    in.read(reinterpret_cast<char*>(mat.data()), mat.size() * sizeof(Scalar));
+    readPadding(in, mat.size() * sizeof(Scalar));
+}
+
+/// Read a priority queue from a binary file.
+auto readPriorityQueue(std::ifstream& in) -> PriorityQueue
+{
+    const auto priorities = readIndices(in);
+    const auto order = readIndices(in);
+    return PriorityQueue::withInitialPrioritiesAndOrder(priorities, order);
+}
+
+/// Return true if a priority queue read from a binary file has given size and its order is a permutation of its entries.
+auto isPriorityQueueValid(PriorityQueue const& queue, Index size) -> bool
+{
+    if(queue.priorities().size() != size || queue.order().size() != size)
+        return false;
+    Deque<bool> found(size, false);
+    for(auto i : queue.order())
+    {
+        if(i >= size || found[i])
+            return false;
+        found[i] = true;
+    }
+    return true;
+}
+
+/// Return the names of the species in a chemical system.
+auto speciesNames(ChemicalSystem const& system) -> Strings
+{
+    Strings names;
+    for(auto const& species : system.species())
+        names.push_back(species.name());
+    return names;
+}
+
 } // namespace detail
 
 struct SmartEquilibriumSolver::Impl
 {
+    /// The chemical equilibrium specifications of the smart equilibrium calculations.
+    EquilibriumSpecs specs;
+
     EquilibriumSolver solver;
 
     EquilibriumSensitivity sensitivity;
@@ -62,9 +279,51 @@ struct SmartEquilibriumSolver::Impl
     /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
     SmartEquilibriumSolver::Grid grid;
 
+    /// The number of records in the knowledge database.
+    Index numrecords = 0;
+
+    /// The memory used by the records in the knowledge database (in bytes).
+    Index nbytes = 0;
+
+    /// The index of temperature in the input variables *w* (or their number if temperature is a *p* control variable).
+    const Index iTw;
+
+    /// The index of pressure in the input variables *w* (or their number if pressure is a *p* control variable).
+    const Index iPw;
+
+    /// The index of pressure in the *p* control variables (if pressure is unknown).
+    const Index iPp;
+
+    /// The auxiliary vector with the changes in *w* and *c* with respect to those in a record.
+    VectorXd dz;
+
+    /// The auxiliary vector with the first-order Taylor increments in *n*, *p*, *q* and *u* predicted from a record.
+    VectorXd dv;
+
+    /// The auxiliary matrix with the changes in *w* and *c* with respect to those in each record of a cluster (one column per record).
+    MatrixXd dzs;
+
+    /// The auxiliary vector with the predicted changes in the chemical potential of a primary species for each record of a cluster.
+    RowVectorXd dmu;
+
+    /// The flags indicating which records of a cluster passed the acceptance test of predictions.
+    Eigen::Array<bool, 1, Eigen::Dynamic> passed;
+
+    /// The auxiliary vector with the normalized *z* = (*w*, *c*) used in the nearest-neighbor search in a cluster.
+    VectorXd znormalized;
+
+    /// The indices of the records in a cluster nearest to the new conditions.
+    Indices inearest;
+
+    /// The indices of the records in a cluster in the order they are tested.
+    Indices candidates;
+
     /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
     Impl(EquilibriumSpecs const& specs)
-    : solver(specs), sensitivity(specs), conditions(specs)
+    : specs(specs), solver(specs), sensitivity(specs), conditions(specs),
+      iTw(index(specs.namesInputs(), "T")),
+      iPw(index(specs.namesInputs(), "P")),
+      iPp(iTw < specs.numInputs() ? 0 : 1) // if temperature is unknown, it is p[0] and pressure (if unknown) is p[1]
     {
         // Initialize the equilibrium solver with the default options
         setOptions(options);
@@ -178,8 +437,24 @@ struct SmartEquilibriumSolver::Impl
         //---------------------------------------------------------------------
         tic(STORAGE_STEP)
 
-        // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
-        EquilibriumPredictor predictor(state, sensitivity);
+        // Create the compact record with the computed equilibrium state and its sensitivities
+        auto record = createRecord(state);
+
+        const auto bytes = record.memory();
+
+        // Discard the record if it cannot fit in the knowledge database even after evicting all other records
+        if(options.max_memory > 0 && bytes > options.max_memory)
+        {
+            result.learning.discarded_records += 1;
+            result.timing.learning_storage = toc(STORAGE_STEP);
+            return;
+        }
+
+        // Evict the least frequently used records if needed to store the new one within the limits of the knowledge database
+        evictRecords(bytes);
+
+        numrecords += 1;
+        nbytes += bytes;
 
         // Round temperature and pressure according to their respective step lengths for discretization
         const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
@@ -199,8 +474,7 @@ struct SmartEquilibriumSolver::Impl
         if (icluster < cell.clusters.size())
         {
             auto& cluster = cell.clusters[icluster];
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
+            storeRecord(cluster, std::move(record));
         }
         else
         {
@@ -208,11 +482,10 @@ struct SmartEquilibriumSolver::Impl
             Cluster cluster;
             cluster.iprimary = iprimary;
             cluster.label = label;
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
+            storeRecord(cluster, std::move(record));
 
             // Append the new cluster and initialize its connectivity and priority
-            cell.clusters.push_back(cluster);
+            cell.clusters.push_back(std::move(cluster));
             cell.connectivity.extend();
             cell.priority.extend();
         }
@@ -220,9 +493,285 @@ struct SmartEquilibriumSolver::Impl
         result.timing.learning_storage = toc(STORAGE_STEP);
     }
 
+    /// Create a record for the knowledge database with a computed chemical equilibrium state and its sensitivity derivatives.
+    auto createRecord(ChemicalState const& state) -> Record
+    {
+        const auto Nn = sensitivity.dndw().rows();
+        const auto Np = sensitivity.dpdw().rows();
+        const auto Nq = sensitivity.dqdw().rows();
+        const auto Nu = sensitivity.dudw().rows();
+        const auto Nw = sensitivity.dndw().cols();
+        const auto Nc = sensitivity.dndc().cols();
+
+        // Assemble the sensitivity derivatives dv/dz of v = (n, p, q, u) with respect to z = (w, c)
+        MatrixXd dvdz(Nn + Np + Nq + Nu, Nw + Nc);
+        dvdz.topRows(Nn)                 << sensitivity.dndw(), sensitivity.dndc();
+        dvdz.middleRows(Nn, Np)          << sensitivity.dpdw(), sensitivity.dpdc();
+        dvdz.middleRows(Nn + Np, Nq)     << sensitivity.dqdw(), sensitivity.dqdc();
+        dvdz.bottomRows(Nu)              << sensitivity.dudw(), sensitivity.dudc();
+
+        Record record{
+            state.speciesAmounts().cast<double>().matrix(),
+            VectorXd(state.props()),
+            state.equilibrium(),
+            MatrixXd(),
+            MatrixXf()
+        };
+
+        if(options.single_precision_sensitivity)
+            record.dvdzf = dvdz.cast<float>();
+        else record.dvdz = std::move(dvdz);
+
+        return record;
+    }
+
+    /// Store a record in a cluster together with its data needed in the acceptance test of predictions.
+    auto storeRecord(Cluster& cluster, Record&& record) -> void
+    {
+        const auto Nw = record.equilibrium.w().size();
+        const auto Nc = record.equilibrium.c().size();
+        const auto Nz = Nw + Nc;
+        const auto Nb = cluster.iprimary.size();
+        const auto icol = cluster.records.size();
+
+        VectorXd z(Nz);
+        z.head(Nw) = record.equilibrium.w();
+        z.tail(Nc) = record.equilibrium.c();
+
+        VectorXd mu(Nb);
+        VectorXd dmudz(Nb * Nz);
+
+        for(auto i = 0; i < Nb; ++i)
+        {
+            const auto ispecies = cluster.iprimary[i];
+            const auto k = indexChemicalPotential(record, ispecies);
+            mu[i] = speciesChemicalPotentialReference(record, ispecies);
+            if(record.dvdzf.size())
+                dmudz.segment(i * Nz, Nz) = record.dvdzf.row(k).transpose().cast<double>();
+            else dmudz.segment(i * Nz, Nz) = record.dvdz.row(k).transpose();
+        }
+
+        detail::setColumnWithCapacity(cluster.z, icol, z);
+        detail::setColumnWithCapacity(cluster.mu, icol, mu);
+        detail::setColumnWithCapacity(cluster.dmudz, icol, dmudz);
+
+        // The scaling factors for z are fixed by the first record (an entry equal to zero is not scaled)
+        if(icol == 0)
+            cluster.zscale = (z.array() == 0.0).select(1.0, z.array().abs()).matrix();
+
+        cluster.index.insert(z.cwiseQuotient(cluster.zscale));
+
+        cluster.records.push_back(std::move(record));
+        cluster.priority.extend();
+    }
+
+    /// Evict the least frequently used records until a new record with given memory can be stored within the limits of the knowledge database.
+    /// The usage counts of the records in the priority queues of their clusters are compared
+    /// across the whole knowledge database (among records with the same smallest usage count
+    /// in a cluster, the oldest one is evicted).
+    auto evictRecords(Index bytes) -> void
+    {
+        auto exceeded = [&]()
+        {
+            return (options.max_records > 0 && numrecords + 1 > options.max_records) ||
+                   (options.max_memory > 0 && nbytes + bytes > options.max_memory);
+        };
+
+        while(numrecords > 0 && exceeded())
+        {
+            Pair<long, long> key;
+            Index icluster = 0;
+            Index irecord = 0;
+            Index count = std::numeric_limits<Index>::max();
+
+            for(auto const& [ikey, cell] : grid.cells)
+            {
+                for(auto i = 0; i < cell.clusters.size(); ++i)
+                {
+                    auto const& priorities = cell.clusters[i].priority.priorities();
+                    const auto j = std::min_element(priorities.begin(), priorities.end()) - priorities.begin();
+                    if(priorities[j] < count)
+                    {
+                        key = ikey;
+                        icluster = i;
+                        irecord = j;
+                        count = priorities[j];
+                    }
+                }
+            }
+
+            removeRecord(key, icluster, irecord);
+        }
+    }
+
+    /// Remove a record from a cluster in a temperature-pressure grid cell (together with the cluster and the cell if they become empty).
+    auto removeRecord(Pair<long, long> const& key, Index icluster, Index irecord) -> void
+    {
+        auto& cell = grid.cells.at(key);
+        auto& cluster = cell.clusters[icluster];
+        const auto R = cluster.records.size();
+
+        numrecords -= 1;
+        nbytes -= cluster.records[irecord].memory();
+
+        result.learning.evicted_records += 1;
+
+        // Remove the cluster if this is its last record (and the cell if this is its last cluster)
+        if(R == 1)
+        {
+            cell.clusters.erase(cell.clusters.begin() + icluster);
+            cell.connectivity.remove(icluster);
+            cell.priority.remove(icluster);
+
+            result.learning.evicted_clusters += 1;
+
+            if(cell.clusters.empty())
+                grid.cells.erase(key);
+
+            return;
+        }
+
+        cluster.records.erase(cluster.records.begin() + irecord);
+        cluster.priority.remove(irecord);
+
+        detail::removeColumn(cluster.z, irecord, R);
+        detail::removeColumn(cluster.mu, irecord, R);
+        detail::removeColumn(cluster.dmudz, irecord, R);
+
+        // Rebuild the nearest-neighbor index because the indices of the records after the removed one have changed
+        cluster.index.clear();
+        for(auto j = 0; j < R - 1; ++j)
+            cluster.index.insert(cluster.z.col(j).cwiseQuotient(cluster.zscale));
+    }
+
+    /// Perform the acceptance test of predictions at given *z* = (*w*, *c*) for all records in a cluster at once.
+    /// The predicted changes in the chemical potentials of the primary species are computed for all records
+    /// using the contiguous matrices in the cluster. The changes in *z* with respect to each record are
+    /// stored in `dzs` and the outcome of the test for each record in `passed`.
+    auto updateErrorTest(Cluster const& cluster, VectorXdConstRef z) -> void
+    {
+        const auto R = cluster.records.size();
+        const auto Nz = z.size();
+        const auto Nb = cluster.iprimary.size();
+
+        dzs.noalias() = (-cluster.z.leftCols(R)).colwise() + z;
+
+        passed.setConstant(R, true);
+
+        for(auto i = 0; i < Nb; ++i)
+        {
+            dmu.noalias() = (cluster.dmudz.middleRows(i * Nz, Nz).leftCols(R).array() * dzs.array()).colwise().sum().matrix();
+            passed = passed && (dmu.array().abs() < options.reltol * cluster.mu.row(i).head(R).array().abs() + options.abstol); // false if any value is NaN
+        }
+    }
+
+    /// Perform the acceptance test of predictions at given *z* = (*w*, *c*) for only the given records in a cluster.
+    /// The outcome of the test for the other records in `passed` is meaningless, and so are their columns in `dzs`.
+    auto updateErrorTest(Cluster const& cluster, VectorXdConstRef z, Indices const& irecords) -> void
+    {
+        const auto R = cluster.records.size();
+        const auto Nz = z.size();
+        const auto Nb = cluster.iprimary.size();
+
+        dzs.resize(Nz, R);
+        passed.resize(R);
+
+        for(auto irecord : irecords)
+        {
+            dzs.col(irecord) = z - cluster.z.col(irecord);
+            passed[irecord] = true;
+            for(auto i = 0; i < Nb && passed[irecord]; ++i)
+            {
+                const auto dmui = cluster.dmudz.col(irecord).segment(i * Nz, Nz).dot(dzs.col(irecord));
+                passed[irecord] = std::abs(dmui) < options.reltol * std::abs(cluster.mu(i, irecord)) + options.abstol; // false if any value is NaN
+            }
+        }
+    }
+
+    /// Update the indices of the records in a cluster in the order they are tested at given *z* = (*w*, *c*).
+    /// The records nearest to *z* come first, followed by the others in the order of their usage counts
+    /// (unless only the nearest records are tested).
+    auto updateCandidates(Cluster const& cluster, VectorXdConstRef z) -> void
+    {
+        auto const& records_ordering = cluster.priority.order();
+
+        if(options.nearest_records == 0)
+        {
+            candidates.assign(records_ordering.begin(), records_ordering.end());
+            return;
+        }
+
+        znormalized = z.cwiseQuotient(cluster.zscale);
+
+        cluster.index.nearest(znormalized, options.nearest_records, inearest);
+
+        candidates = inearest;
+
+        if(options.nearest_records_only)
+            return;
+
+        for(auto irecord : records_ordering)
+            if(!contains(inearest, irecord))
+                candidates.push_back(irecord);
+    }
+
+    /// Return the index in *v* = (*n*, *p*, *q*, *u*) of the chemical potential of a species.
+    auto indexChemicalPotential(Record const& record, Index ispecies) const -> Index
+    {
+        const auto Nn = record.n.size();
+        const auto Nv = record.dvdz.rows() + record.dvdzf.rows();
+        return Nv - Nn + ispecies; // the chemical potentials of the species are the last entries in u
+    }
+
+    /// Return the chemical potential of a species at the reference chemical equilibrium state of a record.
+    auto speciesChemicalPotentialReference(Record const& record, Index ispecies) const -> double
+    {
+        const auto Nn = record.n.size();
+        const auto Nu = record.u.size();
+        return record.u[Nu - Nn + ispecies];
+    }
+
+    /// Perform a first-order Taylor prediction of the chemical state from a record (with changes in *w* and *c* in `dz`).
+    auto predictFromRecord(Record const& record, ChemicalState& state) -> void
+    {
+        if(record.dvdzf.size())
+            dv.noalias() = (record.dvdzf * dz.cast<float>()).cast<double>();
+        else dv.noalias() = record.dvdz * dz;
+
+        const auto Nn = record.n.size();
+        const auto Np = record.equilibrium.p().size();
+        const auto Nq = record.equilibrium.q().size();
+        const auto Nu = record.u.size();
+        const auto Nw = record.equilibrium.w().size();
+        const auto Nc = record.equilibrium.c().size();
+
+        const VectorXd n = record.n + dv.head(Nn);
+        const VectorXd p = record.equilibrium.p().matrix() + dv.segment(Nn, Np);
+        const VectorXd q = record.equilibrium.q().matrix() + dv.segment(Nn + Np, Nq);
+        const VectorXd u = record.u + dv.tail(Nu);
+        const VectorXd w = record.equilibrium.w().matrix() + dz.head(Nw);
+        const VectorXd c = record.equilibrium.c().matrix() + dz.tail(Nc);
+
+        state.setSpeciesAmounts(n.array());
+        state.props().update(u.array());
+        state.equilibrium() = record.equilibrium;
+        state.equilibrium().setControlVariablesP(p.array());
+        state.equilibrium().setControlVariablesQ(q.array());
+        state.equilibrium().setInputVariables(w.array());
+        state.equilibrium().setInitialComponentAmounts(c.array());
+
+        const auto T = iTw < Nw ? w[iTw] : p[0]; // get temperature from given *w* or predicted *p*
+        const auto P = iPw < Nw ? w[iPw] : p[iPp]; // get pressure from given *w* or predicted *p*
+
+        state.setTemperature(T);
+        state.setPressure(P);
+    }
+
     /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
     auto predict(ChemicalState& state, EquilibriumConditions const& conditions) -> void
     {
+        REAKTORO_PROFILE_SCOPE("SmartEquilibriumSolver::predict");
+
         // Set the prediction status to false at the beginning
         result.prediction.accepted = false;
 
@@ -247,41 +796,11 @@ struct SmartEquilibriumSolver::Impl
         const auto wvals = conditions.inputValuesGetOrCompute(state);
         const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
 
-        const auto w = wvals.cast<double>();
-        const auto c = cvals.cast<double>();
-
-        // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
-        VectorXd dw;
-        VectorXd dc;
-
-        // The function that checks if a record in the grid pass the error test.
-        auto pass_error_test = [&](Record const& record) mutable -> bool
-        {
-            // The primary species at the reference chemical state
-            auto const& iprimary0 = record.state.equilibrium().indicesPrimarySpecies();
-
-            // The equilibrium predictor calculator at the reference state
-            auto const& predictor0 = record.predictor;
+        const ArrayXd w = wvals.cast<double>();
+        const ArrayXd c = cvals.cast<double>();
 
-            const auto w0 = record.state.equilibrium().w();
-            const auto c0 = record.state.equilibrium().c();
-
-            dw = w - w0;
-            dc = c - c0;
-
-            using std::abs;
-            using std::isnan;
-
-            for(auto ispecies : iprimary0)
-            {
-                const auto mu0 = predictor0.speciesChemicalPotentialReference(ispecies);
-                const auto mu1 = predictor0.speciesChemicalPotentialPredicted(ispecies, dw, dc);
-                if(abs(mu1 - mu0) >= options.reltol * abs(mu0) + options.abstol || isnan(mu0) || isnan(mu1))
-                    return false;
-            }
-
-            return true;
-        };
+        VectorXd z(w.size() + c.size());
+        z << w.matrix(), c.matrix();
 
         // Generate the hash number for indices of primary species in the state
         const auto iprimary = state.equilibrium().indicesPrimarySpecies();
@@ -317,24 +836,30 @@ struct SmartEquilibriumSolver::Impl
         // Iterate over all clusters (starting with icluster)
         for(auto jcluster : clusters_ordering)
         {
-            // Fetch records from the cluster and the order they have to be processed in
+            // Fetch records from the cluster and the order they have to be processed in (nearest ones first)
             auto const& records = cell.clusters[jcluster].records;
-            auto const& records_ordering = cell.clusters[jcluster].priority.order();
 
-            // Iterate over all records in current cluster (using the order based on the priorities)
-            for(auto irecord : records_ordering)
-            {
-                auto const& record = records[irecord];
+            updateCandidates(cell.clusters[jcluster], z);
+
+            //---------------------------------------------------------------------
+            // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
+            //---------------------------------------------------------------------
+            tic(ERROR_CONTROL_STEP)
+
+            // Check which records in the current cluster pass the error test (all at once, unless only the nearest ones are tested)
+            if(options.nearest_records_only && options.nearest_records > 0)
+                updateErrorTest(cell.clusters[jcluster], z, candidates);
+            else updateErrorTest(cell.clusters[jcluster], z);
 
-                //---------------------------------------------------------------------
-                // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
-                //---------------------------------------------------------------------
-                tic(ERROR_CONTROL_STEP)
+            result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
 
-                // Check if the current record passes the error test
-                const auto success = pass_error_test(record);
+            // Iterate over the candidate records in current cluster (the nearest ones first and then using the order based on the priorities)
+            for(auto irecord : candidates)
+            {
+                auto const& record = records[irecord];
 
-                result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+                // Check if the current record passed the error test
+                const auto success = passed[irecord];
 
                 if(success)
                 {
@@ -343,9 +868,9 @@ struct SmartEquilibriumSolver::Impl
                     //---------------------------------------------------------------------
                     tic(TAYLOR_STEP)
 
-                    auto const& predictor0 = record.predictor;
+                    dz = dzs.col(irecord); // the changes in w and c with respect to those in the current record
 
-                    predictor0.predict(state, conditions);
+                    predictFromRecord(record, state);
 
                     result.timing.prediction_taylor = toc(TAYLOR_STEP);
 
@@ -411,11 +936,210 @@ struct SmartEquilibriumSolver::Impl
     //
     //=================================================================================================================
 
+    /// Save the knowledge database of the smart equilibrium solver to a binary file.
+    auto save(String const& filename) const -> void
+    {
+        using namespace detail;
+
+        std::ofstream out(filename, std::ios::binary);
+        errorif(!out, "Could not open file `", filename, "` to save the knowledge database of a smart equilibrium solver.");
+
+        out.write(binarysignature, std::strlen(binarysignature));
+        writeUnsigned(out, binaryversion);
+
+        // Write the data used to check the database is used later with the same chemical system and specifications
+        writeStrings(out, speciesNames(specs.system()));
+        writeStrings(out, specs.namesInputs());
+        writeStrings(out, specs.namesControlVariablesP());
+        writeStrings(out, specs.namesControlVariablesQ());
+        writeUnsigned(out, specs.numConservativeComponents());
+
+        // Write the steps of the temperature-pressure grid, since the keys of its cells depend on them
+        writeDouble(out, options.temperature_step);
+        writeDouble(out, options.pressure_step);
+
+        writeUnsigned(out, grid.cells.size());
+        for(auto const& [key, cell] : grid.cells)
+        {
+            writeSigned(out, key.first);
+            writeSigned(out, key.second);
+            writeUnsigned(out, cell.clusters.size());
+            for(auto const& cluster : cell.clusters)
+            {
+                writeArray(out, cluster.iprimary);
+                writeUnsigned(out, cluster.label);
+                writeUnsigned(out, cluster.records.size());
+                for(auto const& record : cluster.records)
+                {
+                    auto const& optstate = record.equilibrium.optimaState();
+                    writeArray(out, record.n);
+                    writeArray(out, record.u);
+                    writeArray(out, record.equilibrium.w());
+                    writeArray(out, record.equilibrium.c());
+                    writeUnsigned(out, optstate.dims.x);
+                    writeUnsigned(out, optstate.dims.p);
+                    writeUnsigned(out, optstate.dims.be);
+                    writeUnsigned(out, optstate.dims.c);
+                    writeArray(out, optstate.x);
+                    writeArray(out, optstate.p);
+                    writeArray(out, optstate.y);
+                    writeArray(out, optstate.ye);
+                    writeArray(out, optstate.s);
+                    writeArray(out, optstate.jb);
+                    writeArray(out, optstate.jn);
+                    writeArray(out, record.dvdz);
+                    writeArray(out, record.dvdzf);
+                }
+                writePriorityQueue(out, cluster.priority);
+            }
+            for(auto i = 0; i <= cell.clusters.size(); ++i) // the last one is the priority queue based on usage counts of clusters
+                writePriorityQueue(out, cell.connectivity.priorityQueue(i));
+            writePriorityQueue(out, cell.priority);
+        }
+
+        errorif(!out, "Could not write the knowledge database of a smart equilibrium solver to file `", filename, "`.");
+    }
+
+    /// Load the knowledge database of the smart equilibrium solver from a binary file.
+    auto load(String const& filename) -> void
+    {
+        using namespace detail;
+
+        std::ifstream in(filename, std::ios::binary);
+        errorif(!in, "Could not open file `", filename, "` to load the knowledge database of a smart equilibrium solver.");
+
+        String signature(std::strlen(binarysignature), ' ');
+        in.read(signature.data(), signature.size());
+        errorif(signature != binarysignature, "The file `", filename, "` does not contain the knowledge database of a smart equilibrium solver.");
+
+        const auto version = readUnsigned(in);
+        errorif(version != binaryversion, "The file `", filename, "` contains the knowledge database of a smart equilibrium solver "
+            "in format version ", version, ", but only version ", binaryversion, " is supported.");
+
+        errorif(readStrings(in) != speciesNames(specs.system()), "The knowledge database of a smart equilibrium solver in file `", filename, "` "
+            "was created with a chemical system whose species are not the same as in the chemical system of this solver.");
+
+        const auto inputs = readStrings(in);
+        const auto pnames = readStrings(in);
+        const auto qnames = readStrings(in);
+        const auto numcomponents = readUnsigned(in);
+
+        errorif(inputs != specs.namesInputs() || pnames != specs.namesControlVariablesP() || qnames != specs.namesControlVariablesQ() || numcomponents != specs.numConservativeComponents(),
+            "The knowledge database of a smart equilibrium solver in file `", filename, "` was created with "
+            "equilibrium specifications whose inputs, control variables or conservative components are not the same as in this solver.");
+
+        const auto temperature_step = readDouble(in);
+        const auto pressure_step = readDouble(in);
+
+        errorif(temperature_step != options.temperature_step || pressure_step != options.pressure_step,
+            "The knowledge database of a smart equilibrium solver in file `", filename, "` was created with temperature and pressure steps ",
+            temperature_step, " and ", pressure_step, ", which are not the same as in the options of this solver (",
+            options.temperature_step, " and ", options.pressure_step, ").");
+
+        // The expected dimensions of the data in the records
+        const long Nn = specs.system().species().size();
+        const long Np = specs.numControlVariablesP();
+        const long Nq = specs.numControlVariablesQ();
+        const long Nu = VectorXd(ChemicalProps(specs.system())).size();
+        const long Nw = specs.numInputs();
+        const long Nc = specs.numConservativeComponents();
+        const long Nv = Nn + Np + Nq + Nu; // the number of rows of dv/dz
+        const long Nz = Nw + Nc;           // the number of columns of dv/dz
+
+        const auto corrupted = str("The file `", filename, "` with the knowledge database of a smart equilibrium solver is corrupted: ");
+
+        Grid loaded;
+        Index loadednumrecords = 0;
+        Index loadednbytes = 0;
+
+        const auto numcells = readUnsigned(in);
+        for(auto icell = 0; icell < numcells && in; ++icell)
+        {
+            const auto iT = readSigned(in);
+            const auto iP = readSigned(in);
+            auto& cell = loaded.cells[{iT, iP}];
+            const auto numclusters = readUnsigned(in);
+            for(auto icluster = 0; icluster < numclusters && in; ++icluster)
+            {
+                Cluster cluster;
+                readArray(in, cluster.iprimary);
+                errorif(in && cluster.iprimary.size() && (cluster.iprimary.minCoeff() < 0 || cluster.iprimary.maxCoeff() >= Nn),
+                    corrupted, "the indices of the primary species of a cluster are out of range.");
+                cluster.label = readUnsigned(in);
+                const auto numrecords = readUnsigned(in);
+                for(auto irecord = 0; irecord < numrecords && in; ++irecord)
+                {
+                    Record record{ VectorXd(), VectorXd(), ChemicalState::Equilibrium(specs.system()), MatrixXd(), MatrixXf() };
+                    ArrayXd w, c;
+                    Optima::Dims dims;
+                    readArray(in, record.n);
+                    readArray(in, record.u);
+                    readArray(in, w);
+                    readArray(in, c);
+                    dims.x  = readUnsigned(in);
+                    dims.p  = readUnsigned(in);
+                    dims.be = readUnsigned(in);
+                    dims.c  = readUnsigned(in);
+                    Optima::State optstate(dims);
+                    readArray(in, optstate.x);
+                    readArray(in, optstate.p);
+                    readArray(in, optstate.y);
+                    readArray(in, optstate.ye);
+                    readArray(in, optstate.s);
+                    readArray(in, optstate.jb);
+                    readArray(in, optstate.jn);
+                    readArray(in, record.dvdz);
+                    readArray(in, record.dvdzf);
+                    if(!in)
+                        break;
+                    errorif(record.n.size() != Nn || record.u.size() != Nu || w.size() != Nw || c.size() != Nc,
+                        corrupted, "a record has arrays n, u, w or c with sizes not matching this solver.");
+                    const auto dvdzok  = record.dvdz.rows() == Nv && record.dvdz.cols() == Nz && record.dvdzf.size() == 0;
+                    const auto dvdzfok = record.dvdzf.rows() == Nv && record.dvdzf.cols() == Nz && record.dvdz.size() == 0;
+                    errorif(!dvdzok && !dvdzfok, corrupted, "a record has sensitivity derivatives dv/dz with dimensions ",
+                        record.dvdz.rows() + record.dvdzf.rows(), "x", record.dvdz.cols() + record.dvdzf.cols(), ", but ", Nv, "x", Nz, " was expected.");
+                    record.equilibrium.setNamesInputVariables(inputs);
+                    record.equilibrium.setNamesControlVariablesP(pnames);
+                    record.equilibrium.setNamesControlVariablesQ(qnames);
+                    record.equilibrium.setOptimaState(optstate);
+                    record.equilibrium.setInputVariables(w);
+                    record.equilibrium.setInitialComponentAmounts(c);
+                    loadednumrecords += 1;
+                    loadednbytes += record.memory();
+                    storeRecord(cluster, std::move(record));
+                }
+                cluster.priority = readPriorityQueue(in);
+                errorif(in && !isPriorityQueueValid(cluster.priority, cluster.records.size()),
+                    corrupted, "the priority queue of the records of a cluster does not match its number of records.");
+                cell.clusters.push_back(std::move(cluster));
+            }
+            Deque<PriorityQueue> queues;
+            for(auto i = 0; i < cell.clusters.size(); ++i)
+                queues.push_back(readPriorityQueue(in));
+            const auto queue = readPriorityQueue(in);
+            cell.priority = readPriorityQueue(in);
+            if(!in)
+                break;
+            const auto numclustersok = [&](PriorityQueue const& q) { return isPriorityQueueValid(q, cell.clusters.size()); };
+            errorif(!std::all_of(queues.begin(), queues.end(), numclustersok) || !numclustersok(queue) || !numclustersok(cell.priority),
+                corrupted, "the priority queues of the clusters in a temperature-pressure cell do not match its number of clusters.");
+            cell.connectivity = ClusterConnectivity::withPriorityQueues(queues, queue);
+        }
+
+        errorif(!in, "The file `", filename, "` with the knowledge database of a smart equilibrium solver is truncated.");
+
+        grid = std::move(loaded);
+        numrecords = loadednumrecords;
+        nbytes = loadednbytes;
+    }
+
     /// Set the options of the smart equilibrium solver
     auto setOptions(SmartEquilibriumOptions const& opts) -> void
     {
         options = opts;
-        solver.setOptions(opts.learning);
+        auto learning = opts.learning;
+        learning.sensitivity = {}; // the predictions need all sensitivity derivatives, so these cannot be restricted
+        solver.setOptions(learning);
     }
 };
 
@@ -491,4 +1215,58 @@ auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options)
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::save(String const& filename) const -> void
+{
+    pimpl->save(filename);
+}
+
+auto SmartEquilibriumSolver::load(String const& filename) -> void
+{
+    pimpl->load(filename);
+}
+
+auto SmartEquilibriumSolver::numRecords() const -> Index
+{
+    return pimpl->numrecords;
+}
+
+auto SmartEquilibriumSolver::grid() const -> Grid const&
+{
+    return pimpl->grid;
+}
+
+auto SmartEquilibriumSolver::memory() const -> Index
+{
+    Index bytes = 0;
+    for(auto const& [key, cell] : pimpl->grid.cells)
+    {
+        for(auto const& cluster : cell.clusters)
+        {
+            bytes += detail::memory(cluster.z) + detail::memory(cluster.mu) + detail::memory(cluster.dmudz) + detail::memory(cluster.zscale) + cluster.index.memory();
+            for(auto const& record : cluster.records)
+                bytes += record.memory();
+        }
+    }
+    return bytes;
+}
+
+auto SmartEquilibriumSolver::Record::memory() const -> Index
+{
+    auto const& optstate = equilibrium.optimaState();
+    return sizeof(Record)
+        + detail::memory(n)
+        + detail::memory(u)
+        + detail::memory(dvdz)
+        + detail::memory(dvdzf)
+        + detail::memory(equilibrium.w())
+        + detail::memory(equilibrium.c())
+        + detail::memory(optstate.x)
+        + detail::memory(optstate.p)
+        + detail::memory(optstate.y)
+        + detail::memory(optstate.ye)
+        + detail::memory(optstate.s)
+        + detail::memory(optstate.jb)
+        + detail::memory(optstate.jn);
+}
+
 } // namespace Reaktoro
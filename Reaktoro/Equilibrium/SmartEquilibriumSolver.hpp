@@ -22,10 +22,8 @@
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/ODML/ClusterConnectivity.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
 
 namespace Reaktoro {
@@ -34,7 +32,9 @@ namespace Reaktoro {
 class ChemicalProps;
 class ChemicalState;
 class ChemicalSystem;
+class EquilibriumConditions;
 class EquilibriumRestrictions;
+class EquilibriumSensitivity;
 class EquilibriumSpecs;
 struct SmartEquilibriumOptions;
 struct SmartEquilibriumResult;
@@ -123,20 +123,57 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(SmartEquilibriumOptions const& options) -> void;
 
+    /// Save the knowledge database of learned calculations to a binary file.
+    /// The file starts with the characters `RKTSMART` and the version of its
+    /// format as a 64-bit unsigned integer. Next come the names of the species,
+    /// the input variables and the *p* and *q* control variables, and the number
+    /// of conservative components, and the temperature and pressure steps of
+    /// the grid, which @ref load uses to check the file matches this solver. Then, for each temperature-pressure grid cell,
+    /// the file holds its clusters, records and priority queues. Every string
+    /// and array is stored with its size and padded to a multiple of 8 bytes,
+    /// so the arrays keep an 8-byte alignment (e.g., if the file is memory mapped).
+    auto save(String const& filename) const -> void;
+
+    /// Load the knowledge database of learned calculations from a binary file written with @ref save.
+    /// The current knowledge database is replaced. An error is raised if the file was written by a
+    /// solver with a different chemical system, different equilibrium specifications, or different
+    /// temperature and pressure steps in its options (so set these options before loading), or if
+    /// the dimensions of its records and priority queues are inconsistent.
+    auto load(String const& filename) -> void;
+
+    /// Return the number of records in the knowledge database.
+    auto numRecords() const -> Index;
+
+    /// Return the memory used by the records in the knowledge database (in bytes).
+    /// The average memory per record is this value divided by @ref numRecords.
+    auto memory() const -> Index;
+
     /// The record of the knowledge database containing input, output, and derivatives data.
+    /// Each learned chemical equilibrium state is stored once in compact form,
+    /// with only what is needed for first-order Taylor predictions from it.
+    /// Let *v* = (*n*, *p*, *q*, *u*) denote the species amounts, the *p* and
+    /// *q* control variables and the serialized chemical properties, and
+    /// *z* = (*w*, *c*) the input variables and initial component amounts.
+    /// The sensitivity derivatives *dv/dz* are stored in a single matrix.
     struct Record
     {
-        /// The fully calculated chemical equilibrium state.
-        ChemicalState state;
+        /// The amounts of the species *n* at the reference chemical equilibrium state.
+        VectorXd n;
+
+        /// The serialized chemical properties *u* at the reference chemical equilibrium state.
+        VectorXd u;
+
+        /// The equilibrium data at the reference chemical equilibrium state (with *w*, *c*, *p*, *q* and primary species).
+        ChemicalState::Equilibrium equilibrium;
 
-        /// The conditions at which the chemical equilibrium state was calculated.
-        EquilibriumConditions conditions;
+        /// The sensitivity derivatives *dv/dz* at the reference chemical equilibrium state (empty if stored with single precision).
+        MatrixXd dvdz;
 
-        /// The sensitivity derivatives at the calculated chemical equilibrium state.
-        EquilibriumSensitivity sensitivity;
+        /// The sensitivity derivatives *dv/dz* at the reference chemical equilibrium state stored with single precision (empty otherwise).
+        MatrixXf dvdzf;
 
-        /// The predictor of chemical equilibrium states at given new conditions.
-        EquilibriumPredictor predictor;
+        /// Return the memory used by this record (in bytes).
+        auto memory() const -> Index;
     };
 
     /// The cluster storing learned input-output data with same classification.
@@ -153,6 +190,28 @@ public:
 
         /// The priority queue for the records based on their usage count.
         PriorityQueue priority;
+
+        /// The input variables and initial component amounts *z* = (*w*, *c*) of the records (one column per record).
+        /// The data of the records needed in the acceptance test of predictions are
+        /// also stored in contiguous matrices, so that this test is performed for
+        /// all records in the cluster at once. The capacity of these matrices may
+        /// exceed the number of records, and only their first `records.size()`
+        /// columns are meaningful.
+        MatrixXd z;
+
+        /// The chemical potentials of the primary species of the records (one column per record).
+        MatrixXd mu;
+
+        /// The derivatives of the chemical potentials of the primary species with respect to *z* of the records (one column per record).
+        /// The derivatives of the chemical potential of the i-th primary species
+        /// are in the i-th block of rows of size equal to the size of *z*.
+        MatrixXd dmudz;
+
+        /// The scaling factors used to normalize *z* = (*w*, *c*) in the nearest-neighbor index of the records.
+        VectorXd zscale;
+
+        /// The nearest-neighbor index of the records over their normalized *z* = (*w*, *c*).
+        KdTree index;
     };
 
     /// The collection of clusters containing learned input-output data associated to a temperature-pressure grid cell.
@@ -178,6 +237,9 @@ public:
         Map<Pair<long, long>, Cell> cells;
     };
 
+    /// Return the temperature-pressure grid with the knowledge database of learned calculations.
+    auto grid() const -> Grid const&;
+
 private:
     struct Impl;
 
@@ -48,5 +48,9 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("save", &SmartEquilibriumSolver::save, "Save the knowledge database of learned calculations to a binary file.", py::arg("filename"))
+        .def("load", &SmartEquilibriumSolver::load, "Load the knowledge database of learned calculations from a binary file written with save.", py::arg("filename"))
+        .def("numRecords", &SmartEquilibriumSolver::numRecords, "Return the number of records in the knowledge database.")
+        .def("memory", &SmartEquilibriumSolver::memory, "Return the memory used by the records in the knowledge database (in bytes).")
         ;
 }
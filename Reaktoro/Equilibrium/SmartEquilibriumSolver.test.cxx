@@ -16,7 +16,11 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 
 // Catch includes
 #include <catch2/catch.hpp>
@@ -114,5 +118,263 @@ TEST_CASE("Testing SmartEquilibriumSolver", "[SmartEquilibriumSolver]")
         CHECK( result.succeeded() );
         CHECK( result.learned() );
         CHECK( result.iterations() == 17 );
+
+        CHECK( solver.numRecords() == 2 );
+        CHECK( solver.memory() > 0 );
+
+        //-------------------------------------------------------------------------------------------------------------
+        // CHECK THE RECORDS STORED WITH SINGLE PRECISION SENSITIVITY DERIVATIVES PRODUCE SIMILAR PREDICTIONS
+        //-------------------------------------------------------------------------------------------------------------
+
+        SmartEquilibriumOptions options;
+        options.single_precision_sensitivity = true;
+
+        SmartEquilibriumSolver fsolver(system);
+        fsolver.setOptions(options);
+
+        state = ChemicalState(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = fsolver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( fsolver.numRecords() == 1 );
+
+        // Compare the memory of the records of the same learned state stored with double and single precision
+        SmartEquilibriumSolver dsolver(system);
+
+        ChemicalState dstate(system);
+        dstate.temperature(25.0, "celsius");
+        dstate.pressure(1.0, "bar");
+        dstate.set("H2O(aq)", 1.0, "kg");
+        dstate.set("Calcite", 1.0, "mol");
+
+        CHECK( dsolver.solve(dstate).learned() );
+
+        auto const& drecord = dsolver.grid().cells.begin()->second.clusters.front().records.front();
+        auto const& frecord = fsolver.grid().cells.begin()->second.clusters.front().records.front();
+
+        CHECK( drecord.dvdzf.size() == 0 );
+        CHECK( frecord.dvdz.size() == 0 );
+        CHECK( frecord.dvdzf.size() == drecord.dvdz.size() );
+        CHECK( drecord.memory() - frecord.memory() == drecord.dvdz.size() * (sizeof(double) - sizeof(float)) );
+        CHECK( fsolver.memory() < dsolver.memory() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        exactstate = state;
+        exactsolver.solve(exactstate);
+
+        result = fsolver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        CHECK( largestRelativeDifference(state.speciesAmounts(), exactstate.speciesAmounts()) == Approx(0.0577497634).epsilon(1e-3) );
+
+        //-------------------------------------------------------------------------------------------------------------
+        // CHECK THE KNOWLEDGE DATABASE CAN BE SAVED AND LOADED INTO ANOTHER SOLVER THAT THEN PREDICTS WITHOUT LEARNING
+        //-------------------------------------------------------------------------------------------------------------
+
+        const auto filename = "SmartEquilibriumSolver.test.bin";
+
+        solver.save(filename);
+
+        SmartEquilibriumSolver lsolver(system);
+        lsolver.load(filename);
+
+        CHECK( lsolver.numRecords() == solver.numRecords() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        exactstate = state;
+        exactsolver.solve(exactstate);
+
+        result = lsolver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        CHECK( largestRelativeDifference(state.speciesAmounts(), exactstate.speciesAmounts()) < 0.1 );
+
+        ChemicalSystem othersystem(db, solution);
+
+        SmartEquilibriumSolver othersolver(othersystem);
+
+        CHECK_THROWS( othersolver.load(filename) );
+
+        options = {};
+        options.temperature_step *= 2.0;
+
+        SmartEquilibriumSolver stepsolver(system);
+        stepsolver.setOptions(options);
+
+        CHECK_THROWS( stepsolver.load(filename) ); // the keys of the temperature-pressure grid cells depend on the steps
+
+        // Check a file with an invalid priority queue is rejected (the last 8 bytes are the last index in the order of the clusters of the last cell)
+        std::ifstream in(filename, std::ios::binary);
+        String bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+
+        std::fill(bytes.end() - 8, bytes.end(), '\xff');
+
+        const auto corruptedfilename = "SmartEquilibriumSolver.test.corrupted.bin";
+
+        std::ofstream out(corruptedfilename, std::ios::binary);
+        out.write(bytes.data(), bytes.size());
+        out.close();
+
+        SmartEquilibriumSolver csolver(system);
+
+        CHECK_THROWS( csolver.load(corruptedfilename) );
+        CHECK( csolver.numRecords() == 0 ); // the knowledge database is unchanged
+
+        std::remove(filename);
+        std::remove(corruptedfilename);
+
+        //-------------------------------------------------------------------------------------------------------------
+        // CHECK THE LEAST FREQUENTLY USED RECORDS ARE EVICTED WHEN THE KNOWLEDGE DATABASE IS BOUNDED
+        //-------------------------------------------------------------------------------------------------------------
+
+        options = {};
+        options.max_records = 1;
+
+        SmartEquilibriumSolver bsolver(system);
+        bsolver.setOptions(options);
+
+        state = ChemicalState(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = bsolver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( result.learning.evicted_records == 0 );
+        CHECK( bsolver.numRecords() == 1 );
+
+        state = ChemicalState(system);
+        state.temperature(50.0, "celsius");
+        state.pressure(10.0, "bar");
+        state.set("H2O(aq)", 2.0, "kg");
+        state.set("Calcite", 2.0, "mol");
+
+        result = bsolver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( result.learning.evicted_records == 1 );
+        CHECK( result.learning.evicted_clusters == 1 );
+        CHECK( bsolver.numRecords() == 1 );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = bsolver.solve(state);
+
+        CHECK( result.learned() ); // the record at 25 celsius that could have been used for a prediction was evicted
+        CHECK( bsolver.numRecords() == 1 );
+
+        //-------------------------------------------------------------------------------------------------------------
+        // CHECK THE RECORD WITH THE SMALLEST USAGE COUNT IS EVICTED AMONG SEVERAL CLUSTERS
+        //-------------------------------------------------------------------------------------------------------------
+
+        options = {};
+        options.max_records = 2;
+
+        SmartEquilibriumSolver esolver(system);
+        esolver.setOptions(options);
+
+        auto createState = [&](double T, double P, double water, double calcite)
+        {
+            ChemicalState s(system);
+            s.temperature(T, "celsius");
+            s.pressure(P, "bar");
+            s.set("H2O(aq)", water, "kg");
+            s.set("Calcite", calcite, "mol");
+            return s;
+        };
+
+        state = createState(25.0, 1.0, 1.0, 1.0); // calcite remains at equilibrium
+        CHECK( esolver.solve(state).learned() );
+
+        state = createState(25.0, 1.0, 1.0, 1.0e-6); // calcite dissolves completely, so the primary species are not the same
+        CHECK( esolver.solve(state).learned() );
+
+        REQUIRE( esolver.grid().cells.size() == 1 );
+        REQUIRE( esolver.grid().cells.begin()->second.clusters.size() == 2 );
+
+        const auto labelused = esolver.grid().cells.begin()->second.clusters[0].label; // the cluster of the record used in the predictions below
+
+        for(auto i = 0; i < 2; ++i)
+        {
+            state = createState(25.0, 1.0, 1.01, 1.01);
+            CHECK( esolver.solve(state).predicted() );
+        }
+
+        state = createState(50.0, 10.0, 2.0, 2.0); // learned in another grid cell, which requires an eviction
+        result = esolver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( result.learning.evicted_records == 1 );
+        CHECK( result.learning.evicted_clusters == 1 );
+        CHECK( esolver.numRecords() == 2 );
+
+        auto const& cells = esolver.grid().cells;
+
+        REQUIRE( cells.size() == 2 );
+
+        auto const it = std::find_if(cells.begin(), cells.end(), [&](auto const& entry) { return entry.second.clusters.front().label == labelused; });
+
+        REQUIRE( it != cells.end() );
+
+        auto const& cell = it->second;
+
+        CHECK( cell.clusters.size() == 1 ); // the cluster whose only record was never used was evicted
+        CHECK( cell.clusters.front().records.size() == 1 );
+        CHECK( cell.connectivity.size() == 1 );
+        CHECK( cell.priority.size() == 1 );
+        CHECK( cell.connectivity.order(0) == Deque<Index>{ 0 } );
+        CHECK( cell.connectivity.order(1) == Deque<Index>{ 0 } ); // the order based on the usage counts of the clusters
+
+        state = createState(25.0, 1.0, 1.01, 1.01);
+        CHECK( esolver.solve(state).predicted() ); // the most used record was kept
+
+        state = createState(25.0, 1.0, 1.0, 1.0e-6);
+        CHECK( esolver.solve(state).learned() ); // the evicted record needs to be learned again
+
+        //-------------------------------------------------------------------------------------------------------------
+        // CHECK A RECORD LARGER THAN THE MEMORY LIMIT IS NOT STORED AND NOTHING IS EVICTED FOR IT
+        //-------------------------------------------------------------------------------------------------------------
+
+        options = {};
+        options.max_memory = 1; // smaller than any record
+
+        SmartEquilibriumSolver msolver(system);
+        msolver.setOptions(options);
+
+        state = createState(25.0, 1.0, 1.0, 1.0);
+        result = msolver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+        CHECK( result.learning.discarded_records == 1 );
+        CHECK( result.learning.evicted_records == 0 );
+        CHECK( msolver.numRecords() == 0 );
+        CHECK( msolver.memory() == 0 );
     }
 }
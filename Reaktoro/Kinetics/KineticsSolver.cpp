@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -161,6 +162,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, real const& dt) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, kconditions);
@@ -168,6 +170,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, kconditions, restrictions);
@@ -175,6 +178,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, kconditions);
@@ -182,6 +186,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, kconditions, restrictions);
@@ -195,6 +200,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, sensitivity, kconditions);
@@ -202,6 +208,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
@@ -209,6 +216,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, sensitivity, kconditions);
@@ -216,6 +224,7 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE_SCOPE("KineticsSolver::solve");
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadLocal.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/CubicEOS.hpp>
 #include <Reaktoro/Singletons/CriticalProps.hpp>
@@ -97,6 +98,43 @@ auto activityModelCubicEOS(SpeciesList const& specieslist, CubicEOS::EquationMod
     return model;
 }
 
+auto activityDerivsModelCubicEOS(SpeciesList const& specieslist, CubicEOS::EquationModel const& eqmodel, CubicEOS::BipModel const& bipmodel) -> ActivityDerivsModel
+{
+    CubicEOS::EquationSpecs eqspecs;
+    eqspecs.substances = collectSubstancesInFluidPhase(specieslist);
+    eqspecs.eqmodel = eqmodel;
+    eqspecs.bipmodel = bipmodel;
+
+    // The cubic equation of state and its computed properties, one pair per thread
+    using Workspace = Pair<CubicEOS::Equation, CubicEOS::Props>;
+    ThreadLocal<Workspace> local(Workspace(CubicEOS::Equation(eqspecs), CubicEOS::Props()));
+
+    // Define the function for the analytic derivatives of the activities of the species in the fluid phase
+    ActivityDerivsModel fn = [=](ActivityDerivs& derivs, ActivityModelArgs args)
+    {
+        // The arguments for the activity model evaluation
+        auto const& [T, P, x] = args;
+
+        auto& [equation, cprops] = local.local();
+
+        const auto nspecies = x.size();
+
+        derivs.ln_a_T.resize(nspecies);
+        derivs.ln_a_P.resize(nspecies);
+        derivs.ln_a_x.resize(nspecies, nspecies);
+
+        equation.compute(cprops, T, P, x);
+        equation.computeLnPhiDerivatives(derivs.ln_a_T, derivs.ln_a_P, derivs.ln_a_x);
+
+        // Add the derivatives of the ideal contribution ln(x) + ln(Pbar)
+        derivs.ln_a_P += 1.0/P.val();
+        for(auto i = 0; i < nspecies; ++i)
+            derivs.ln_a_x(i, i) += 1.0/x[i].val();
+    };
+
+    return fn;
+}
+
 auto CubicBipModelPhreeqc() -> CubicBipModelGenerator
 {
     return [](SpeciesList const& specieslist) -> CubicEOS::BipModel
@@ -117,11 +155,19 @@ auto CubicBipModelSoreideWhitson() -> CubicBipModelGenerator
 
 auto ActivityModelCubicEOS(CubicBipModelGenerator cbipmodel, CubicEOS::EquationModel const& eqmodel) -> ActivityModelGenerator
 {
-    return [=](SpeciesList const& specieslist) -> ActivityModel
+    ActivityModelGenerator model = [=](SpeciesList const& specieslist) -> ActivityModel
     {
         CubicEOS::BipModel bipmodel = cbipmodel ? cbipmodel(specieslist) : CubicEOS::BipModel{};
         return activityModelCubicEOS(specieslist, eqmodel, bipmodel);
     };
+
+    ActivityDerivsModelGenerator derivs = [=](SpeciesList const& specieslist) -> ActivityDerivsModel
+    {
+        CubicEOS::BipModel bipmodel = cbipmodel ? cbipmodel(specieslist) : CubicEOS::BipModel{};
+        return activityDerivsModelCubicEOS(specieslist, eqmodel, bipmodel);
+    };
+
+    return withActivityDerivs(model, derivs);
 }
 
 auto ActivityModelVanDerWaals(CubicBipModelGenerator cbipmodel) -> ActivityModelGenerator
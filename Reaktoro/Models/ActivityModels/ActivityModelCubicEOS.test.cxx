@@ -39,6 +39,41 @@ inline auto checkActivities(ArrayXrConstRef x, real P, ActivityPropsConstRef pro
     }
 }
 
+// Check the analytic derivatives of the ln activities of the species against those computed with automatic differentiation.
+inline auto checkActivityDerivs(ActivityModelGenerator const& generator, SpeciesList const& species, real T, real P, ArrayXr x)
+{
+    ActivityModel fn = generator(species);
+
+    const auto derivsgenerator = activityDerivsModel(generator);
+
+    REQUIRE( derivsgenerator );
+
+    ActivityDerivsModel derivsfn = derivsgenerator(species);
+
+    ActivityDerivs derivs;
+    derivsfn(derivs, {T, P, x});
+
+    ActivityProps props = ActivityProps::create(species.size());
+
+    // Return the derivatives of the ln activities of the species with respect to given variable using automatic differentiation
+    auto ln_a_wrt = [&](real& var) -> VectorXd
+    {
+        autodiff::seed(var);
+        fn(props, {T, P, x});
+        autodiff::unseed(var);
+        return grad(props.ln_a);
+    };
+
+    CHECK( derivs.ln_a_T.matrix().isApprox(ln_a_wrt(T)) );
+    CHECK( derivs.ln_a_P.matrix().isApprox(ln_a_wrt(P)) );
+
+    for(auto j = 0; j < x.size(); ++j)
+    {
+        INFO("j = " << j);
+        CHECK( derivs.ln_a_x.col(j).isApprox(ln_a_wrt(x[j])) );
+    }
+}
+
 } // anonymous namespace
 
 TEST_CASE("Testing ActivityModelCubicEOS", "[ActivityModelCubicEOS]")
@@ -246,4 +281,21 @@ TEST_CASE("Testing ActivityModelCubicEOS", "[ActivityModelCubicEOS]")
             checkActivities(x, P, props);
         }
     }
+
+    //=============================================
+    // ANALYTIC DERIVATIVES OF THE ACTIVITIES
+    //=============================================
+    WHEN("The analytic derivatives of the activities are checked")
+    {
+        const auto species = SpeciesList("CO2 H2O CH4");
+
+        const ArrayXr x = ArrayXr{{0.90, 0.08, 0.02}};
+
+        checkActivityDerivs(ActivityModelPengRobinson(), species, 25.0 + 273.15, 1.0 * 1e5, x);   // gas state
+        checkActivityDerivs(ActivityModelPengRobinson(), species, 10.0 + 273.15, 100.0 * 1e5, x); // liquid state
+        checkActivityDerivs(ActivityModelPengRobinson76(), species, 60.0 + 273.15, 100.0 * 1e5, x);
+        checkActivityDerivs(ActivityModelSoaveRedlichKwong(), species, 60.0 + 273.15, 100.0 * 1e5, x);
+        checkActivityDerivs(ActivityModelRedlichKwong(), species, 60.0 + 273.15, 100.0 * 1e5, x);
+        checkActivityDerivs(ActivityModelVanDerWaals(), species, 60.0 + 273.15, 100.0 * 1e5, x);
+    }
 }
@@ -57,7 +57,7 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
     const ArrayXd charges = mixture.charges()(icharged_species);
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> stateptr; // allocated on first evaluation (see ThreadLocal)
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -67,6 +67,7 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
+        if(!stateptr) stateptr = std::make_shared<AqueousMixtureState>();
         auto const& state = *stateptr = mixture.state(T, P, x);
 
         // Set the state of matter of the phase
@@ -147,6 +148,137 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
     return fn;
 }
 
+/// Return the ActivityDerivsModel object based on the Davies model.
+auto activityDerivsModelDavies(const SpeciesList& species, ActivityModelDaviesParams params) -> ActivityDerivsModel
+{
+    // Create the aqueous mixture
+    AqueousMixture mixture(species);
+
+    // The molar mass of water
+    const auto Mw = mixture.water().molarMass();
+
+    // The number of species in the aqueous mixture
+    const auto num_species = species.size();
+
+    // The indices of the charged and neutral species
+    const auto icharged_species = mixture.indicesCharged();
+    const auto ineutral_species = mixture.indicesNeutral();
+
+    // The index of the water species
+    const auto iwater = mixture.indexWater();
+
+    // The electrical charges of the charged species only
+    const ArrayXd charges = mixture.charges()(icharged_species);
+
+    // The coefficients of the molalities of the species in the stoichiometric ionic strength (zero for water)
+    ArrayXd wI = ArrayXd::Zero(num_species);
+    wI(icharged_species) = 0.5 * charges * charges;
+    wI(ineutral_species) = 0.5 * (mixture.dissociationMatrix() * (charges * charges).matrix()).array();
+
+    // The parameters of the Davies model
+    const auto bions = params.bions.val();
+    const auto bneutrals = params.bneutrals.val();
+
+    // Define the function for the analytic derivatives of the activities of the species
+    ActivityDerivsModel fn = [=](ActivityDerivs& derivs, ActivityModelArgs args)
+    {
+        // The arguments for the activity model evaluation
+        const auto& [T, P, x] = args;
+
+        // Evaluate the state of the aqueous mixture and, only if requested, the derivatives of water density and dielectric constant wrt T and P
+        real Tr = T.val();
+        real Pr = P.val();
+        if(derivs.compute_TP) autodiff::seed(Tr);
+        const auto stateT = mixture.state(Tr, Pr, x);
+        if(derivs.compute_TP) autodiff::unseed(Tr);
+        auto rhoP = 0.0;     // the derivative of water density wrt P
+        auto epsilonP = 0.0; // the derivative of water dielectric constant wrt P
+        if(derivs.compute_TP)
+        {
+            autodiff::seed(Pr);
+            const auto stateP = mixture.state(Tr, Pr, x);
+            autodiff::unseed(Pr);
+            rhoP = grad(stateP.rho);
+            epsilonP = grad(stateP.epsilon);
+        }
+
+        // Auxiliary constant references
+        const ArrayXd m = stateT.m;              // the molalities of all species
+        const auto I = stateT.Is.val();          // the stoichiometric ionic strength
+        const auto rho = stateT.rho.val();       // the density of water
+        const auto epsilon = stateT.epsilon.val(); // the dielectric constant of water
+
+        // Auxiliary variables
+        const auto xw = x[iwater].val();
+        const auto sqrtI = std::sqrt(I);
+        const auto T_epsilon = T.val() * epsilon;
+        const auto A = 1.824829238e+6 * std::sqrt(rho/1000)/(T_epsilon*std::sqrt(T_epsilon));
+        const auto A_T = A * (0.5*grad(stateT.rho)/rho - 1.5*(1.0/T.val() + grad(stateT.epsilon)/epsilon));
+        const auto A_P = A * (0.5*rhoP/rho - 1.5*epsilonP/epsilon);
+        const auto sigman = bneutrals*I * ln10;
+        const auto sigmac_A = -(sqrtI/(1 + sqrtI) - bions*I) * ln10;                                         // the derivative of sigmac wrt A
+        const auto sigmac_I = (I > 0.0) ? -A*(0.5/(sqrtI*(1 + sqrtI)*(1 + sqrtI)) - bions) * ln10 : 0.0; // the derivative of sigmac wrt I
+        const auto sigman_I = bneutrals * ln10;                                                            // the derivative of sigman wrt I
+        const auto h = 2*(I + 2*sqrtI)/(1 + sqrtI) - 4*log(1 + sqrtI) - bions*I*I;                       // the term in ln_a[iwater] multiplying ln10*Mw*A
+        const auto h_I = sqrtI/((1 + sqrtI)*(1 + sqrtI)) - 2*bions*I;                                     // the derivative of h wrt I
+
+        // The derivatives of the stoichiometric ionic strength wrt the mole fractions of the species
+        ArrayXd I_x = wI/(Mw*xw);
+        I_x[iwater] = -I/xw;
+
+        // The sum of the molalities of the neutral species and its derivatives wrt the mole fractions of the species
+        const auto mn = m(ineutral_species).sum();
+        ArrayXd mn_x = ArrayXd::Zero(num_species);
+        mn_x(ineutral_species) = 1.0/(Mw*xw);
+        mn_x[iwater] = -mn/xw;
+
+        auto& ln_a_T = derivs.ln_a_T;
+        auto& ln_a_P = derivs.ln_a_P;
+        auto& ln_a_x = derivs.ln_a_x;
+
+        ln_a_T.setZero(num_species);
+        ln_a_P.setZero(num_species);
+        ln_a_x.setZero(num_species, num_species);
+
+        // The derivatives of the ln molalities of the solutes wrt the mole fractions of the species
+        for(auto i = 0; i < num_species; ++i)
+        {
+            if(i == iwater) continue;
+            ln_a_x(i, i) = 1.0/x[i].val();
+            ln_a_x(i, iwater) = -1.0/xw;
+        }
+
+        // The derivatives of the ln activities of the charged species
+        for(Index i = 0; i < icharged_species.size(); ++i)
+        {
+            const auto ispecies = icharged_species[i];
+            const auto z2 = charges[i]*charges[i];
+            ln_a_x.row(ispecies) += z2 * sigmac_I * I_x.matrix().transpose();
+            ln_a_T[ispecies] = z2 * sigmac_A * A_T;
+            ln_a_P[ispecies] = z2 * sigmac_A * A_P;
+        }
+
+        // The derivatives of the ln activities of the neutral species
+        for(auto ispecies : ineutral_species)
+            ln_a_x.row(ispecies) += sigman_I * I_x.matrix().transpose();
+
+        // The derivatives of the ln activity of water
+        ln_a_x.row(iwater) = (ln10*Mw*A*h_I - Mw*sigman_I*mn) * I_x.matrix().transpose() - Mw*sigman * mn_x.matrix().transpose();
+        ln_a_x(iwater, iwater) += 1.0/(xw*xw);
+        ln_a_T[iwater] = ln10*Mw*h*A_T;
+        ln_a_P[iwater] = ln10*Mw*h*A_P;
+
+        // The derivatives wrt T and P computed above are meaningless if they were not requested
+        if(!derivs.compute_TP)
+        {
+            ln_a_T.resize(0);
+            ln_a_P.resize(0);
+        }
+    };
+
+    return fn;
+}
+
 } // namespace detail
 
 auto ActivityModelDavies() -> ActivityModelGenerator
@@ -156,10 +288,17 @@ auto ActivityModelDavies() -> ActivityModelGenerator
 
 auto ActivityModelDavies(ActivityModelDaviesParams params) -> ActivityModelGenerator
 {
-    return [=](const SpeciesList& species)
+    ActivityModelGenerator model = [=](const SpeciesList& species)
     {
         return detail::activityModelDavies(species, params);
     };
+
+    ActivityDerivsModelGenerator derivs = [=](const SpeciesList& species)
+    {
+        return detail::activityDerivsModelDavies(species, params);
+    };
+
+    return withActivityDerivs(model, derivs);
 }
 
 } // namespace Reaktoro
@@ -60,6 +60,50 @@ inline auto checkActivities(ArrayXrConstRef x, ActivityPropsConstRef props)
     }
 }
 
+// Check the analytic derivatives of the ln activities of the species against those computed with automatic differentiation.
+inline auto checkActivityDerivs(ActivityModelGenerator const& generator, SpeciesList const& species, real T, real P, ArrayXr x)
+{
+    ActivityModel fn = generator(species);
+
+    const auto derivsgenerator = activityDerivsModel(generator);
+
+    REQUIRE( derivsgenerator );
+
+    ActivityDerivsModel derivsfn = derivsgenerator(species);
+
+    ActivityDerivs derivs;
+    derivsfn(derivs, {T, P, x});
+
+    ActivityProps props = ActivityProps::create(species.size());
+
+    // Return the derivatives of the ln activities of the species with respect to given variable using automatic differentiation
+    auto ln_a_wrt = [&](real& var) -> VectorXd
+    {
+        autodiff::seed(var);
+        fn(props, {T, P, x});
+        autodiff::unseed(var);
+        return grad(props.ln_a);
+    };
+
+    CHECK( derivs.ln_a_T.matrix().isApprox(ln_a_wrt(T)) );
+    CHECK( derivs.ln_a_P.matrix().isApprox(ln_a_wrt(P)) );
+
+    for(auto j = 0; j < x.size(); ++j)
+    {
+        INFO("j = " << j);
+        CHECK( derivs.ln_a_x.col(j).isApprox(ln_a_wrt(x[j])) );
+    }
+
+    // Check only the derivatives wrt the mole fractions are computed when those wrt T and P are not requested
+    ActivityDerivs xderivs;
+    xderivs.compute_TP = false;
+    derivsfn(xderivs, {T, P, x});
+
+    CHECK( xderivs.ln_a_T.size() == 0 );
+    CHECK( xderivs.ln_a_P.size() == 0 );
+    CHECK( xderivs.ln_a_x == derivs.ln_a_x );
+}
+
 } // anonymous namespace
 
 TEST_CASE("Testing ActivityModelDavies", "[ActivityModelDavies]")
@@ -130,4 +174,15 @@ TEST_CASE("Testing ActivityModelDavies", "[ActivityModelDavies]")
 
         checkActivities(x, props);
     }
+
+    SECTION("Checking the analytic derivatives of the activities")
+    {
+        checkActivityDerivs(ActivityModelDavies(), species, T, P, x);
+
+        ActivityModelDaviesParams params;
+        params.bions = 0.2;
+        params.bneutrals = 0.15;
+
+        checkActivityDerivs(ActivityModelDavies(params), species, T, P, x);
+    }
 }
@@ -327,7 +327,7 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
     }
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> stateptr; // allocated on first evaluation (see ThreadLocal)
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -337,6 +337,7 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
+        if(!stateptr) stateptr = std::make_shared<AqueousMixtureState>();
         auto const& state = *stateptr = mixture.state(T, P, x);
 
         // Set the state of matter of the phase
@@ -425,6 +426,188 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
     return fn;
 }
 
+/// Return the ActivityDerivsModel object based on the Debye-Huckel model.
+auto activityDerivsModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuckelParams params) -> ActivityDerivsModel
+{
+    // Create the aqueous mixture
+    AqueousMixture mixture(species);
+
+    // The molar mass of water
+    const auto Mw = mixture.water().molarMass();
+
+    // The number of species in the aqueous mixture
+    const auto num_species = species.size();
+
+    // The number of charged species in the aqueous mixture
+    const auto num_charged_species = mixture.charged().size();
+
+    // The indices of the charged and neutral species
+    const auto icharged_species = mixture.indicesCharged();
+    const auto ineutral_species = mixture.indicesNeutral();
+
+    // The index of the water species
+    const auto iwater = mixture.indexWater();
+
+    // The electrical charges of the charged species only
+    const ArrayXd charges = mixture.charges()(icharged_species);
+
+    // The dissociation matrix of the neutral species into charged species
+    const MatrixXd dissociation_matrix = mixture.dissociationMatrix();
+
+    // The coefficients of the molalities of the species in the stoichiometric ionic strength (zero for water)
+    ArrayXd wI = ArrayXd::Zero(num_species);
+    wI(icharged_species) = 0.5 * charges * charges;
+    wI(ineutral_species) = 0.5 * (dissociation_matrix * (charges * charges).matrix()).array();
+
+    // The Debye-Huckel parameters a and b of the charged species
+    ArrayXd aions(num_charged_species), bions(num_charged_species);
+
+    // The Debye-Huckel parameter b of the neutral species
+    ArrayXd bneutral(ineutral_species.size());
+
+    // Collect the Debye-Huckel parameters a and b of the charged species
+    for(Index i = 0; i < num_charged_species; ++i)
+    {
+        const auto species = mixture.species(icharged_species[i]);
+        aions[i] = params.aion(species.formula()).val();
+        bions[i] = params.bion(species.formula()).val();
+    }
+
+    // Collect the Debye-Huckel parameter b of the neutral species
+    for(Index i = 0; i < ineutral_species.size(); ++i)
+    {
+        const auto species = mixture.species(ineutral_species[i]);
+        bneutral[i] = params.bneutral(species.formula()).val();
+    }
+
+    // Define the function for the analytic derivatives of the activities of the species
+    ActivityDerivsModel fn = [=](ActivityDerivs& derivs, ActivityModelArgs args)
+    {
+        // The arguments for the activity model evaluation
+        const auto& [T, P, x] = args;
+
+        // Evaluate the state of the aqueous mixture and, only if requested, the derivatives of water density and dielectric constant wrt T and P
+        real Tr = T.val();
+        real Pr = P.val();
+        if(derivs.compute_TP) autodiff::seed(Tr);
+        const auto stateT = mixture.state(Tr, Pr, x);
+        if(derivs.compute_TP) autodiff::unseed(Tr);
+        auto rhoP = 0.0;     // the derivative of water density wrt P
+        auto epsilonP = 0.0; // the derivative of water dielectric constant wrt P
+        if(derivs.compute_TP)
+        {
+            autodiff::seed(Pr);
+            const auto stateP = mixture.state(Tr, Pr, x);
+            autodiff::unseed(Pr);
+            rhoP = grad(stateP.rho);
+            epsilonP = grad(stateP.epsilon);
+        }
+
+        // Auxiliary constant references
+        const ArrayXd ms = stateT.ms;              // the stoichiometric molalities of the charged species
+        const auto I = stateT.Is.val();            // the stoichiometric ionic strength
+        const auto rho = stateT.rho.val();         // the density of water
+        const auto epsilon = stateT.epsilon.val(); // the dielectric constant of water
+
+        // Auxiliary variables
+        const auto xw = x[iwater].val();
+        const auto sqrtI = std::sqrt(I);
+        const auto T_epsilon = T.val() * epsilon;
+        const auto sqrt_T_epsilon = std::sqrt(T_epsilon);
+        const auto sqrt_rho = std::sqrt(rho/1000);
+        const auto A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+        const auto B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
+        const auto rho_T = 0.5*grad(stateT.rho)/rho;                              // (d ln sqrt(rho))/dT
+        const auto rho_P = 0.5*rhoP/rho;                                          // (d ln sqrt(rho))/dP
+        const auto Teps_T = 1.0/T.val() + grad(stateT.epsilon)/epsilon;          // d ln(T*epsilon)/dT
+        const auto Teps_P = epsilonP/epsilon;                                    // d ln(T*epsilon)/dP
+        const auto A_T = A * (rho_T - 1.5*Teps_T);
+        const auto A_P = A * (rho_P - 1.5*Teps_P);
+        const auto B_T = B * (rho_T - 0.5*Teps_T);
+        const auto B_P = B * (rho_P - 0.5*Teps_P);
+
+        // The derivatives of the stoichiometric ionic strength wrt the mole fractions of the species
+        ArrayXd I_x = wI/(Mw*xw);
+        I_x[iwater] = -I/xw;
+
+        auto& ln_a_T = derivs.ln_a_T;
+        auto& ln_a_P = derivs.ln_a_P;
+        auto& ln_a_x = derivs.ln_a_x;
+
+        ln_a_T.setZero(num_species);
+        ln_a_P.setZero(num_species);
+        ln_a_x.setZero(num_species, num_species);
+
+        // The derivatives of the ln molalities of the solutes wrt the mole fractions of the species
+        for(auto i = 0; i < num_species; ++i)
+        {
+            if(i == iwater) continue;
+            ln_a_x(i, i) = 1.0/x[i].val();
+            ln_a_x(i, iwater) = -1.0/xw;
+        }
+
+        // The ln activity coefficients of the charged species and the sum of their products with the stoichiometric molalities
+        ArrayXd ln_gc(num_charged_species);
+
+        // The derivatives of the term W in ln_a[iwater] = -Mw*(mSigma + W) wrt I, A and B, at constant stoichiometric molalities
+        auto W_I = 0.0;
+        auto W_A = 0.0;
+        auto W_B = 0.0;
+
+        // The derivatives of the ln activities of the charged species
+        for(Index i = 0; i < num_charged_species; ++i)
+        {
+            const auto ispecies = icharged_species[i];
+            const auto z2 = charges[i]*charges[i];
+            const auto Lambda = 1.0 + aions[i]*B*sqrtI;
+            const auto sigma = (aions[i] != 0.0) ? 3.0*std::pow(Lambda - 1, -3) * ((Lambda - 1)*(Lambda - 3) + 2*log(Lambda)) : 2.0;
+
+            // The ln activity coefficient of the charged species and its derivatives wrt I, A and B
+            ln_gc[i] = ln10 * (-A*z2*sqrtI/Lambda + bions[i]*I);
+            const auto ln_gc_I = (I > 0.0) ? ln10 * (-A*z2*0.5/(sqrtI*Lambda*Lambda) + bions[i]) : 0.0;
+            const auto ln_gc_A = -ln10 * z2*sqrtI/Lambda;
+            const auto ln_gc_B = ln10 * A*z2*aions[i]*I/(Lambda*Lambda);
+
+            ln_a_x.row(ispecies) += ln_gc_I * I_x.matrix().transpose();
+            ln_a_T[ispecies] = ln_gc_A*A_T + ln_gc_B*B_T;
+            ln_a_P[ispecies] = ln_gc_A*A_P + ln_gc_B*B_P;
+
+            // The derivative of the term (2/3)*A*I*sqrt(I)*sigma wrt B (see derivative of sigma wrt Lambda, which is -3*sigma/(Lambda - 1) + 6/(Lambda*(Lambda - 1)))
+            const auto sigmaterm_B = (aions[i] != 0.0 && I > 0.0) ? (2.0/3.0)*A*I*sqrtI*(-3*sigma + 6/Lambda)/B : 0.0;
+
+            W_I += ms[i]*ln_gc_I + ln10*2*A*sqrtI/Lambda - ln10*2*I*bions[i]/z2;
+            W_A += ms[i]*ln_gc_A + ln10*(2.0/3.0)*I*sqrtI*sigma;
+            W_B += ms[i]*ln_gc_B + ln10*sigmaterm_B;
+        }
+
+        // The derivatives of the ln activities of the neutral species
+        for(Index i = 0; i < ineutral_species.size(); ++i)
+            ln_a_x.row(ineutral_species[i]) += ln10 * bneutral[i] * I_x.matrix().transpose();
+
+        // The terms sum(ln_gc[c] * d(ms[c])/dx[j]) in the derivatives of W wrt the mole fractions of the species
+        ArrayXd G = ArrayXd::Zero(num_species);
+        G(icharged_species) = ln_gc;
+        G(ineutral_species) = (dissociation_matrix * ln_gc.matrix()).array();
+        ArrayXd W_x = G/(Mw*xw) + W_I*I_x;
+        W_x[iwater] -= (ln_gc * ms).sum()/xw;
+
+        // The derivatives of the ln activity of water, with ln_a[iwater] = -Mw*(mSigma + W) and mSigma = (1 - xw)/(Mw*xw)
+        ln_a_x.row(iwater) = -Mw * W_x.matrix().transpose();
+        ln_a_x(iwater, iwater) += 1.0/(xw*xw);
+        ln_a_T[iwater] = -Mw * (W_A*A_T + W_B*B_T);
+        ln_a_P[iwater] = -Mw * (W_A*A_P + W_B*B_P);
+
+        // The derivatives wrt T and P computed above are meaningless if they were not requested
+        if(!derivs.compute_TP)
+        {
+            ln_a_T.resize(0);
+            ln_a_P.resize(0);
+        }
+    };
+
+    return fn;
+}
+
 } // namespace detail
 
 auto ActivityModelDebyeHuckelParams::aion(const ChemicalFormula& ion) const -> real
@@ -478,10 +661,17 @@ auto ActivityModelDebyeHuckel() -> ActivityModelGenerator
 
 auto ActivityModelDebyeHuckel(ActivityModelDebyeHuckelParams params) -> ActivityModelGenerator
 {
-    return [=](const SpeciesList& species)
+    ActivityModelGenerator model = [=](const SpeciesList& species)
     {
         return detail::activityModelDebyeHuckel(species, params);
     };
+
+    ActivityDerivsModelGenerator derivs = [=](const SpeciesList& species)
+    {
+        return detail::activityDerivsModelDebyeHuckel(species, params);
+    };
+
+    return withActivityDerivs(model, derivs);
 }
 
 auto ActivityModelDebyeHuckelLimitingLaw() -> ActivityModelGenerator
@@ -189,7 +189,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
     ArrayXr xq;
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> aqstateptr; // allocated on first evaluation (see ThreadLocal)
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -202,6 +202,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         auto const RT = universalGasConstant*T;
 
         // Evaluate the state of the aqueous solution
+        if(!aqstateptr) aqstateptr = std::make_shared<AqueousMixtureState>();
         auto const& aqstate = *aqstateptr = solution.state(T, P, x);
 
         // The ionic strength of the solution and its square root
@@ -334,7 +334,7 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
     }
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> stateptr; // allocated on first evaluation (see ThreadLocal)
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous phase
@@ -344,6 +344,7 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
+        if(!stateptr) stateptr = std::make_shared<AqueousMixtureState>();
         auto const& state = *stateptr = mixture.state(T, P, x);
 
         // Set the state of matter of the phase
@@ -49,7 +49,26 @@ auto ActivityModelIdealGas() -> ActivityModelGenerator
         return fn;
     };
 
-    return model;
+    ActivityDerivsModelGenerator derivs = [](const SpeciesList& species)
+    {
+        ActivityDerivsModel fn = [](ActivityDerivs& derivs, ActivityModelArgs args)
+        {
+            const auto& [T, P, x] = args;
+
+            const auto N = x.size();
+
+            // The derivatives of ln_a = ln(x) + ln(Pbar)
+            derivs.ln_a_T.setZero(N);
+            derivs.ln_a_P.setConstant(N, 1.0/P.val());
+            derivs.ln_a_x.setZero(N, N);
+            for(auto i = 0; i < N; ++i)
+                derivs.ln_a_x(i, i) = 1.0/x[i].val();
+        };
+
+        return fn;
+    };
+
+    return withActivityDerivs(model, derivs);
 }
 
 } // namespace Reaktoro
@@ -94,7 +94,7 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
     }
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> aqstateptr; // allocated on first evaluation (see ThreadLocal)
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -106,6 +106,7 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         assert(x.minCoeff() > 0.0 && x.maxCoeff() <= 1.0);
 
         // Evaluate the state of the aqueous solution
+        if(!aqstateptr) aqstateptr = std::make_shared<AqueousMixtureState>();
         auto const& aqstate = *aqstateptr = solution.state(T, P, x);
 
         // Set the state of matter of the phase
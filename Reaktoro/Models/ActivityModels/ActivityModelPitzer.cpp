@@ -1002,7 +1002,7 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
     PitzerState pzstate;
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> aqstateptr; // allocated on first evaluation (see ThreadLocal)
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1011,6 +1011,7 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
+        if(!aqstateptr) aqstateptr = std::make_shared<AqueousMixtureState>();
         auto const& aqstate = *aqstateptr = solution.state(T, P, x);
 
         // Set the state of matter of the phase
@@ -1391,7 +1391,7 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
     PitzerParams pitzer(mixture);
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    SharedPtr<AqueousMixtureState> stateptr; // allocated on first evaluation (see ThreadLocal)
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1400,6 +1400,7 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
+        if(!stateptr) stateptr = std::make_shared<AqueousMixtureState>();
         auto const& state = *stateptr = mixture.state(T, P, x);
 
         // Set the state of matter of the phase
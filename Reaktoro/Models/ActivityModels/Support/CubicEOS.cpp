@@ -360,6 +360,15 @@ struct Equation::Impl
     ArrayXr bbar;
     Bip bip;
 
+    /// The quantities of the last evaluation of the cubic equation of state needed for derivatives of ln fugacity coefficients.
+    struct LastState
+    {
+        bool valid = false; ///< The flag that indicates the quantities below have been computed.
+        double T, P, amix, amixT, bmix, beta, q, qT, A, B, C, Z, I;
+        ArrayXd x;
+        MatrixXd aij;
+    } last;
+
     /// Construct an Equation::Impl object.
     Impl(EquationSpecs const& eqspecs)
     : eqspecs(eqspecs),
@@ -388,6 +397,8 @@ struct Equation::Impl
 
     auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
     {
+        last.valid = false;
+
         // Check if the mole fractions are zero or non-initialized
         if(x.size() == 0 || x.maxCoeff() <= 0.0)
             return;
@@ -425,6 +436,7 @@ struct Equation::Impl
         real amixTT = {};
         abar.fill(0.0);
         abarT.fill(0.0);
+        last.aij.resize(nspecies, nspecies);
         for(auto i = 0; i < nspecies; ++i)
         {
             for(auto j = 0; j < nspecies; ++j)
@@ -441,6 +453,8 @@ struct Equation::Impl
                 auto const aijT  = rT*s + r*sT;
                 auto const aijTT = rTT*s + 2.0*rT*sT + r*sTT;
 
+                last.aij(i, j) = aij.val();
+
                 amix   += x[i] * x[j] * aij; // Eq. (13.92) of Smith et al. (2017)
                 amixT  += x[i] * x[j] * aijT;
                 amixTT += x[i] * x[j] * aijTT;
@@ -543,6 +557,23 @@ struct Equation::Impl
             IP = I*(betaP/beta - (ZP + epsilon*betaP)/(Z + epsilon*beta)); // @eq{ I_{P}\equiv\left(\frac{\partial I}{\partial P}\right)_{T}=I\left(\frac{\beta_{P}}{\beta}-\frac{Z_{P}+\epsilon\beta_{P}}{Z+\epsilon\beta}\right) }
         }
 
+        // Keep the quantities needed later in computeLnPhiDerivatives
+        last.T     = T.val();
+        last.P     = P.val();
+        last.amix  = amix.val();
+        last.amixT = amixT.val();
+        last.bmix  = bmix.val();
+        last.beta  = beta.val();
+        last.q     = q.val();
+        last.qT    = qT.val();
+        last.A     = A.val();
+        last.B     = B.val();
+        last.C     = C.val();
+        last.Z     = Z.val();
+        last.I     = I.val();
+        last.x     = x.unaryExpr([](real const& xi) { return xi.val(); });
+        last.valid = true;
+
         //=========================================================================================
         // Calculate the ideal volume properties of the phase
         //=========================================================================================
@@ -586,6 +617,106 @@ struct Equation::Impl
             props.ln_phi[k] = Zk - (Zk - betak)/(Z - beta) - log(Z - beta) + q*I - qk*I - q*Ik;
         }
     }
+
+    auto computeLnPhiDerivatives(ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P, MatrixXdRef ln_phi_x) const -> void
+    {
+        assert(ln_phi_T.size() == nspecies);
+        assert(ln_phi_P.size() == nspecies);
+        assert(ln_phi_x.rows() == nspecies && ln_phi_x.cols() == nspecies);
+
+        ln_phi_T.fill(0.0);
+        ln_phi_P.fill(0.0);
+        ln_phi_x.fill(0.0);
+
+        if(!last.valid)
+            return;
+
+        // Auxiliary references
+        const auto sigma   = eqspecs.eqmodel.sigma.val();
+        const auto epsilon = eqspecs.eqmodel.epsilon.val();
+
+        auto const& [valid, T, P, amix, amixT, bmix, beta, q, qT, A, B, C, Z, I, x, aij] = last;
+
+        const auto es = epsilon*sigma;
+        const auto D = 3*Z*Z + 2*A*Z + B; // the derivative of the cubic polynomial wrt Z
+
+        /// The variations of the quantities of the phase that depend on the variations of beta and q.
+        struct Variation { double beta, q, A, B, C, Z, I; };
+
+        /// Return the variations of the quantities of the phase along a direction with given variations of beta and q.
+        auto variation = [&](double dbeta, double dq) -> Variation
+        {
+            const auto dA = (epsilon + sigma - 1)*dbeta;
+            const auto dB = (es - epsilon - sigma)*(2*beta*dbeta) + dq*beta - (epsilon + sigma - q)*dbeta;
+            const auto dC = -es*(3*beta*beta*dbeta) - dq*beta*beta - (es + q)*(2*beta*dbeta);
+            const auto dZ = -(dA*Z*Z + dB*Z + dC)/D; // from implicit differentiation of Z^3 + AZ^2 + BZ + C = 0
+            const auto dI = (epsilon != sigma) ?
+                ((dZ + sigma*dbeta)/(Z + sigma*beta) - (dZ + epsilon*dbeta)/(Z + epsilon*beta))/(sigma - epsilon) :
+                I*(dbeta/beta - (dZ + epsilon*dbeta)/(Z + epsilon*beta));
+            return { dbeta, dq, dA, dB, dC, dZ, dI };
+        };
+
+        const auto vT    = variation(-beta/T, qT);         // the variations along temperature
+        const auto vP    = variation(beta/P, 0.0);         // the variations along pressure
+        const auto vamix = variation(0.0, q/amix);         // the variations along amix (at constant bmix and abar[k])
+        const auto vbmix = variation(beta/bmix, -q/bmix);  // the variations along bmix (at constant amix and abar[k])
+        const auto vabar = variation(0.0, 0.0);            // the variations along abar[k] (at constant amix and bmix)
+
+        // The derivatives of amix wrt the mole fractions of the species
+        const ArrayXd amix_x = (aij + aij.transpose()) * x.matrix();
+
+        for(auto k = 0; k < nspecies; ++k)
+        {
+            const auto bbark = bbar[k].val();
+            const auto abark = abar[k].val();
+            const auto betak = P*bbark/(R*T);
+            const auto qk    = (1 + abark/amix - bbark/bmix)*q;
+            const auto Ak    = (epsilon + sigma - 1.0)*betak - 1.0;
+            const auto Bk    = ((es - epsilon - sigma)*(2*betak - beta) + qk - q)*beta - (epsilon + sigma - q)*betak;
+            const auto Ck    = (es*(2*beta + 1) + 2*q - qk)*beta*beta - (2*(es + q) + 3*es*beta)*beta*betak;
+            const auto Zk    = -(Ak*Z*Z + (B + Bk)*Z + 2*C + Ck)/D;
+            const auto fk    = 1 + betak/beta - (Zk + epsilon*betak)/(Z + epsilon*beta);
+            const auto Ik    = (epsilon != sigma) ?
+                I + ((Zk + sigma*betak)/(Z + sigma*beta) - (Zk + epsilon*betak)/(Z + epsilon*beta))/(sigma - epsilon) :
+                I * fk;
+
+            // Return the variation of ln_phi[k] along a direction with given variations of the phase, betak and qk.
+            auto dln_phik = [&](Variation const& v, double dbetak, double dqk) -> double
+            {
+                const auto dAk = (epsilon + sigma - 1.0)*dbetak;
+                const auto dBk = ((es - epsilon - sigma)*(2*dbetak - v.beta) + dqk - v.q)*beta
+                    + ((es - epsilon - sigma)*(2*betak - beta) + qk - q)*v.beta
+                    - (epsilon + sigma - q)*dbetak + v.q*betak;
+                const auto dCk = (2*es*v.beta + 2*v.q - dqk)*beta*beta
+                    + (es*(2*beta + 1) + 2*q - qk)*(2*beta*v.beta)
+                    - ((2*v.q + 3*es*v.beta)*beta + (2*(es + q) + 3*es*beta)*v.beta)*betak
+                    - (2*(es + q) + 3*es*beta)*beta*dbetak;
+                const auto dNk = dAk*Z*Z + 2*Ak*Z*v.Z + (v.B + dBk)*Z + (B + Bk)*v.Z + 2*v.C + dCk;
+                const auto dD = 6*Z*v.Z + 2*v.A*Z + 2*A*v.Z + v.B;
+                const auto dZk = -dNk/D - Zk*dD/D;
+                const auto dIk = (epsilon != sigma) ?
+                    v.I + ((dZk + sigma*dbetak)/(Z + sigma*beta) - (Zk + sigma*betak)*(v.Z + sigma*v.beta)/((Z + sigma*beta)*(Z + sigma*beta))
+                         - (dZk + epsilon*dbetak)/(Z + epsilon*beta) + (Zk + epsilon*betak)*(v.Z + epsilon*v.beta)/((Z + epsilon*beta)*(Z + epsilon*beta)))/(sigma - epsilon) :
+                    v.I*fk + I*(dbetak/beta - betak*v.beta/(beta*beta) - (dZk + epsilon*dbetak)/(Z + epsilon*beta) + (Zk + epsilon*betak)*(v.Z + epsilon*v.beta)/((Z + epsilon*beta)*(Z + epsilon*beta)));
+                const auto Zb = Z - beta;
+                return dZk - (dZk - dbetak)/Zb + (Zk - betak)*(v.Z - v.beta)/(Zb*Zb) - (v.Z - v.beta)/Zb
+                    + v.q*I + q*v.I - dqk*I - qk*v.I - v.q*Ik - q*dIk;
+            };
+
+            const auto qkT = (abarT[k].val()/amix - abark*amixT/(amix*amix))*q + (1 + abark/amix - bbark/bmix)*qT;
+
+            ln_phi_T[k] = dln_phik(vT, -betak/T, qkT);
+            ln_phi_P[k] = dln_phik(vP, betak/P, 0.0);
+
+            const auto Fa = dln_phik(vamix, 0.0, (q/amix)*(1 - bbark/bmix));
+            const auto Fb = dln_phik(vbmix, 0.0, -qk/bmix + q*bbark/(bmix*bmix));
+            const auto Fabar = dln_phik(vabar, 0.0, q/amix);
+
+            // Use d(amix)/dx[j] = amix_x[j], d(bmix)/dx[j] = bbar[j] and d(abar[k])/dx[j] = 2*aij(k, j) - amix_x[j]
+            for(auto j = 0; j < nspecies; ++j)
+                ln_phi_x(k, j) = (Fa - Fabar)*amix_x[j] + Fb*bbar[j].val() + 2*Fabar*aij(k, j);
+        }
+    }
 };
 
 Equation::Equation(EquationSpecs const& eqspecs)
@@ -616,6 +747,11 @@ auto Equation::compute(Props& props, real const& T, real const& P, ArrayXrConstR
     return pimpl->compute(props, T, P, x);
 }
 
+auto Equation::computeLnPhiDerivatives(ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P, MatrixXdRef ln_phi_x) const -> void
+{
+    pimpl->computeLnPhiDerivatives(ln_phi_T, ln_phi_P, ln_phi_x);
+}
+
 auto BipModelPhreeqc(Strings const& substances, BipModelParamsPhreeqc const& params) -> BipModel
 {
     auto isubstance = [&](auto... substrs)
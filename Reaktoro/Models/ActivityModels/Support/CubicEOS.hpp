@@ -187,6 +187,15 @@ public:
     /// @param x The mole fractions of the species in the phase (in mol/mol)
     auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void;
 
+    /// Compute the derivatives of the ln fugacity coefficients of the species at the conditions of the last call to @ref compute.
+    /// The derivatives are computed analytically, with the derivatives of the
+    /// compressibility factor obtained by implicit differentiation of the cubic
+    /// equation of state. The mole fractions are taken as independent variables.
+    /// @param[out] ln_phi_T The derivatives of the ln fugacity coefficients with respect to temperature (in 1/K)
+    /// @param[out] ln_phi_P The derivatives of the ln fugacity coefficients with respect to pressure (in 1/Pa)
+    /// @param[out] ln_phi_x The derivatives of the ln fugacity coefficients with respect to the mole fractions of the species
+    auto computeLnPhiDerivatives(ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P, MatrixXdRef ln_phi_x) const -> void;
+
 private:
     struct Impl;
 
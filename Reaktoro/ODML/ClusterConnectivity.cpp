@@ -26,6 +26,15 @@ namespace Reaktoro {
 ClusterConnectivity::ClusterConnectivity()
 {}
 
+auto ClusterConnectivity::withPriorityQueues(Deque<PriorityQueue> const& queues, PriorityQueue const& queue) -> ClusterConnectivity
+{
+    assert(queues.size() == queue.size());
+    ClusterConnectivity connectivity;
+    connectivity.matrix = queues;
+    connectivity.queue = queue;
+    return connectivity;
+}
+
 auto ClusterConnectivity::size() const -> Index
 {
     return queue.size();
@@ -68,10 +77,30 @@ auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
     queue.increment(jcluster);
 }
 
+auto ClusterConnectivity::remove(Index icluster) -> void
+{
+    assert(icluster < size());
+
+    // Remove the priority queue of the cluster in the connectivity matrix
+    matrix.erase(matrix.begin() + icluster);
+
+    // Remove the cluster from the priority queue in each remaining row of the connectivity matrix
+    for(auto& row : matrix)
+        row.remove(icluster);
+
+    // Remove the cluster from the priority queue that keeps track the most used clusters
+    queue.remove(icluster);
+}
+
 auto ClusterConnectivity::order(Index icluster) const -> Deque<Index> const&
 {
     return icluster < size() ? matrix[icluster].order() : queue.order();
 }
 
+auto ClusterConnectivity::priorityQueue(Index icluster) const -> PriorityQueue const&
+{
+    return icluster < size() ? matrix[icluster] : queue;
+}
+
 } // namespace Reaktoro
 
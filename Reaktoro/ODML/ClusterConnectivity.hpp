@@ -30,6 +30,11 @@ public:
     /// Construct a default instance of ClusterConnectivity.
     ClusterConnectivity();
 
+    /// Return a ClusterConnectivity instance with given priority queues (e.g., those of a previously saved instance).
+    /// @param queues The priority queues for the visitation of clusters from each starting cluster.
+    /// @param queue The priority queue for the visitation of clusters based on their usage counts.
+    static auto withPriorityQueues(Deque<PriorityQueue> const& queues, PriorityQueue const& queue) -> ClusterConnectivity;
+
     /// Return number of currently tracked clusters.
     auto size() const -> Index;
 
@@ -45,12 +50,23 @@ public:
     /// ordering of clusters solely based on their usage counts is used instead.
     auto increment(Index icluster, Index jcluster) -> void;
 
+    /// Remove a cluster from the connectivity matrix.
+    /// The clusters after the removed one have their indices decremented by one.
+    /// @param icluster The index of the cluster to be removed.
+    auto remove(Index icluster) -> void;
+
     /// Return the order of clusters for a given starting cluster.
     /// @param icluster The index of the starting cluster.
     /// @note If index `icluster` is equal or greater than number of clusters,
     /// then an ordering based on usage count of clusters is returned.
     auto order(Index icluster) const -> Deque<Index> const&;
 
+    /// Return the priority queue for the visitation of clusters from a given starting cluster.
+    /// @param icluster The index of the starting cluster.
+    /// @note If index `icluster` is equal or greater than number of clusters,
+    /// then the priority queue based on usage count of clusters is returned.
+    auto priorityQueue(Index icluster) const -> PriorityQueue const&;
+
 private:
     /// The connectivity of each cluster with others in terms of priority queue for visitation.
     Deque<PriorityQueue> matrix;
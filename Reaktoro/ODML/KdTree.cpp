@@ -0,0 +1,196 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KdTree.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+namespace {
+
+/// The index used to indicate the absence of a node.
+const auto npos = static_cast<Index>(-1);
+
+/// Return the maximum depth of a tree with given number of points before it is rebuilt.
+auto maxDepthBeforeRebuild(Index size) -> Index
+{
+    return 2 * static_cast<Index>(std::ceil(std::log2(size + 1.0))) + 8;
+}
+
+} // namespace
+
+KdTree::KdTree()
+: root(npos), maxdepth(0)
+{}
+
+auto KdTree::size() const -> Index
+{
+    return nodes.size();
+}
+
+auto KdTree::depth() const -> Index
+{
+    return maxdepth;
+}
+
+auto KdTree::memory() const -> Index
+{
+    return points.size() * sizeof(double) + nodes.capacity() * sizeof(Node);
+}
+
+auto KdTree::clear() -> void
+{
+    points.resize(0, 0);
+    nodes.clear();
+    root = npos;
+    maxdepth = 0;
+}
+
+auto KdTree::insert(VectorXdConstRef point) -> void
+{
+    const auto i = nodes.size();
+
+    errorif(i > 0 && point.size() != points.rows(), "Expecting a point with ", points.rows(), " coordinates in KdTree::insert, but got one with ", point.size(), " coordinates.");
+
+    // Append the coordinates of the new point (increasing the capacity geometrically when needed)
+    if(i >= Index(points.cols()))
+        points.conservativeResize(point.size(), std::max<Index>(2 * points.cols(), 8));
+    points.col(i) = point;
+
+    nodes.push_back({ npos, npos, 0 });
+
+    if(root == npos)
+    {
+        root = i;
+        maxdepth = 1;
+        return;
+    }
+
+    // Descend the tree until an empty child position is found for the new point
+    auto current = root;
+    auto level = 1;
+    while(true)
+    {
+        auto& node = nodes[current];
+        auto& child = point[node.axis] < points(node.axis, current) ? node.left : node.right;
+        ++level;
+        if(child == npos)
+        {
+            child = i;
+            nodes[i].axis = (node.axis + 1) % point.size();
+            break;
+        }
+        current = child;
+    }
+
+    maxdepth = std::max<Index>(maxdepth, level);
+
+    if(maxdepth > maxDepthBeforeRebuild(size()))
+        rebuild();
+}
+
+auto KdTree::nearest(VectorXdConstRef point, Index k, Indices& inearest) const -> void
+{
+    inearest.clear();
+
+    if(root == npos || k == 0)
+        return;
+
+    errorif(point.size() != points.rows(), "Expecting a point with ", points.rows(), " coordinates in KdTree::nearest, but got one with ", point.size(), " coordinates.");
+
+    // The max-heap with the squared distances and indices of the nearest points found so far
+    Vec<Pair<double, Index>> heap;
+    heap.reserve(k + 1);
+
+    search(root, point, k, heap);
+
+    std::sort_heap(heap.begin(), heap.end());
+
+    for(auto const& [distance, i] : heap)
+        inearest.push_back(i);
+}
+
+auto KdTree::rebuild() -> void
+{
+    Indices ipoints(size());
+    std::iota(ipoints.begin(), ipoints.end(), 0);
+    maxdepth = 0;
+    root = build(ipoints.begin(), ipoints.end(), 0);
+}
+
+auto KdTree::build(Indices::iterator begin, Indices::iterator end, Index level) -> Index
+{
+    if(begin == end)
+        return npos;
+
+    maxdepth = std::max<Index>(maxdepth, level + 1);
+
+    const auto axis = level % points.rows();
+    const auto middle = begin + (end - begin) / 2;
+
+    std::nth_element(begin, middle, end, [&](Index l, Index r) { return points(axis, l) < points(axis, r); });
+
+    // Points with the same coordinate as the median along the axis may end up on its left (searches handle this case)
+    auto& node = nodes[*middle];
+    node.axis = axis;
+    node.left = build(begin, middle, level + 1);
+    node.right = build(middle + 1, end, level + 1);
+
+    return *middle;
+}
+
+auto KdTree::search(Index inode, VectorXdConstRef point, Index k, Vec<Pair<double, Index>>& heap) const -> void
+{
+    if(inode == npos)
+        return;
+
+    auto const& node = nodes[inode];
+
+    const auto distance = (points.col(inode) - point).squaredNorm();
+
+    if(heap.size() < k)
+    {
+        heap.emplace_back(distance, inode);
+        std::push_heap(heap.begin(), heap.end());
+    }
+    else if(distance < heap.front().first)
+    {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = { distance, inode };
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    const auto delta = point[node.axis] - points(node.axis, inode);
+
+    const auto nearside = delta < 0.0 ? node.left : node.right;
+    const auto farside = delta < 0.0 ? node.right : node.left;
+
+    search(nearside, point, k, heap);
+
+    // Search the other side of the splitting plane only if it may contain points nearer than those found so far
+    if(heap.size() < k || delta * delta <= heap.front().first)
+        search(farside, point, k, heap);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,96 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to find the nearest neighbors of a point among a growing set of points using a k-d tree.
+/// The points are inserted incrementally and identified by their insertion
+/// order. The tree is rebuilt with median splits whenever its depth becomes
+/// too large compared with the logarithm of the number of points, so that
+/// the cost of a search grows logarithmically with the number of points.
+class KdTree
+{
+public:
+    /// Construct a default instance of KdTree.
+    KdTree();
+
+    /// Return the number of points in the tree.
+    auto size() const -> Index;
+
+    /// Return the depth of the tree.
+    auto depth() const -> Index;
+
+    /// Return the memory used by the tree (in bytes).
+    auto memory() const -> Index;
+
+    /// Remove all points in the tree.
+    auto clear() -> void;
+
+    /// Insert a new point in the tree (its index is the current number of points).
+    /// @param point The coordinates of the new point (with same size for all points)
+    auto insert(VectorXdConstRef point) -> void;
+
+    /// Find the nearest points in the tree to a given point.
+    /// @param point The point whose nearest neighbors are sought
+    /// @param k The maximum number of nearest neighbors
+    /// @param[out] inearest The indices of the nearest points sorted by increasing distance
+    auto nearest(VectorXdConstRef point, Index k, Indices& inearest) const -> void;
+
+private:
+    /// Rebuild the tree as a balanced one using median splits.
+    auto rebuild() -> void;
+
+    /// Build the balanced subtree with given points and return the index of its root.
+    auto build(Indices::iterator begin, Indices::iterator end, Index level) -> Index;
+
+    /// Search the subtree with given root for the nearest points to a given point.
+    auto search(Index node, VectorXdConstRef point, Index k, Vec<Pair<double, Index>>& heap) const -> void;
+
+private:
+    /// The node in the tree corresponding to a point.
+    struct Node
+    {
+        /// The index of the node in the left subtree (with smaller coordinate along the splitting axis).
+        Index left;
+
+        /// The index of the node in the right subtree (with greater or equal coordinate along the splitting axis).
+        Index right;
+
+        /// The index of the coordinate used as splitting axis in this node.
+        Index axis;
+    };
+
+    /// The coordinates of the points in the tree (one column per point, with capacity for more points).
+    MatrixXd points;
+
+    /// The nodes of the tree (the i-th node corresponds to the i-th point).
+    Vec<Node> nodes;
+
+    /// The index of the root node of the tree.
+    Index root;
+
+    /// The depth of the tree.
+    Index maxdepth;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,110 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/KdTree.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return the indices of the k nearest points to a given point using brute force.
+auto nearestBruteForce(MatrixXdConstRef points, VectorXdConstRef point, Index k) -> Indices
+{
+    Indices inearest(points.cols());
+    std::iota(inearest.begin(), inearest.end(), 0);
+    std::stable_sort(inearest.begin(), inearest.end(), [&](Index l, Index r) {
+        return (points.col(l) - point).squaredNorm() < (points.col(r) - point).squaredNorm(); });
+    inearest.resize(std::min<Index>(k, inearest.size()));
+    return inearest;
+}
+
+} // namespace
+
+TEST_CASE("Testing KdTree", "[KdTree]")
+{
+    KdTree tree;
+
+    Indices inearest;
+
+    tree.nearest(VectorXd::Zero(3), 4, inearest);
+
+    CHECK( tree.size() == 0 );
+    CHECK( inearest.empty() );
+
+    WHEN("points are inserted in random order")
+    {
+        const MatrixXd points = MatrixXd::Random(3, 500);
+
+        for(auto i = 0; i < points.cols(); ++i)
+            tree.insert(points.col(i));
+
+        CHECK( tree.size() == 500 );
+        CHECK( tree.depth() <= 2 * std::ceil(std::log2(501.0)) + 8 );
+
+        for(auto j = 0; j < 20; ++j)
+        {
+            const VectorXd point = VectorXd::Random(3);
+            tree.nearest(point, 5, inearest);
+            CHECK( inearest == nearestBruteForce(points, point, 5) );
+        }
+    }
+
+    WHEN("points are inserted in sorted order (which requires the tree to be rebuilt)")
+    {
+        MatrixXd points = MatrixXd::Random(2, 300);
+        points.row(0) = VectorXd::LinSpaced(300, 0.0, 1.0);
+
+        for(auto i = 0; i < points.cols(); ++i)
+            tree.insert(points.col(i));
+
+        CHECK( tree.size() == 300 );
+        CHECK( tree.depth() <= 2 * std::ceil(std::log2(301.0)) + 8 );
+
+        for(auto j = 0; j < 20; ++j)
+        {
+            const VectorXd point = VectorXd::Random(2);
+            tree.nearest(point, 3, inearest);
+            CHECK( inearest == nearestBruteForce(points, point, 3) );
+        }
+
+        tree.nearest(points.col(123), 1, inearest);
+
+        CHECK( inearest == Indices{123} );
+    }
+
+    WHEN("fewer points than requested exist in the tree")
+    {
+        tree.insert(VectorXd::Constant(2, 1.0));
+        tree.insert(VectorXd::Constant(2, 3.0));
+
+        tree.nearest(VectorXd::Constant(2, 2.5), 10, inearest);
+
+        CHECK( inearest == Indices{1, 0} );
+
+        tree.clear();
+
+        CHECK( tree.size() == 0 );
+    }
+}
@@ -113,6 +113,19 @@ auto PriorityQueue::extend() -> void
     _order.push_back(_order.size());
 }
 
+auto PriorityQueue::remove(Index identity) -> void
+{
+    assert(identity < size());
+
+    _priorities.erase(_priorities.begin() + identity);
+    _order.erase(std::find(_order.begin(), _order.end(), identity));
+
+    // Shift the indices of the tracked entities after the removed one
+    for(auto& i : _order)
+        if(i > identity)
+            --i;
+}
+
 auto PriorityQueue::priorities() const -> Deque<Index> const&
 {
     return _priorities;
@@ -56,6 +56,11 @@ public:
     /// Extend the queue with the introduction of a new tracked entity.
     auto extend() -> void;
 
+    /// Remove a tracked entity from the queue.
+    /// The tracked entities after the removed one have their indices decremented by one.
+    /// @param identity The index of the tracked entity.
+    auto remove(Index identity) -> void;
+
     /// Return the current priorities of each tracked entity in the queue.
     auto priorities() const -> Deque<Index> const&;
 
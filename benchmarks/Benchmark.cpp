@@ -0,0 +1,300 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Benchmark.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/Data.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// A benchmark registered with registerBenchmark.
+struct Benchmark
+{
+    String name;    ///< The name of the benchmark.
+    BenchmarkFn fn; ///< The function implementing the benchmark.
+};
+
+/// The measurements of a run of a benchmark.
+struct BenchmarkRun
+{
+    Index iterations = 0; ///< The number of iterations of the timed loop.
+    double realtime = 0.0; ///< The wall time per iteration (in ns).
+    double cputime = 0.0;  ///< The processor time per iteration (in ns).
+};
+
+/// The command-line arguments of the benchmark program.
+struct BenchmarkArgs
+{
+    String filter = ".*";  ///< The regular expression used to select benchmarks by name.
+    Index repetitions = 1; ///< The number of repetitions of each benchmark.
+    double mintime = 0.5;  ///< The minimum time of the timed loop (in s).
+    String out;            ///< The path of the JSON file where the results are saved (if not empty).
+    bool list = false;     ///< The flag indicating the benchmarks should only be listed.
+};
+
+/// Return the registered benchmarks.
+auto benchmarks() -> Vec<Benchmark>&
+{
+    static Vec<Benchmark> instance;
+    return instance;
+}
+
+/// Parse the command-line arguments of the benchmark program.
+auto parseArgs(int argc, char const* argv[]) -> BenchmarkArgs
+{
+    BenchmarkArgs args;
+    for(auto i = 1; i < argc; ++i)
+    {
+        const String arg = argv[i];
+        const auto pos = arg.find('=');
+        const auto key = arg.substr(0, pos);
+        const auto value = pos == String::npos ? String() : arg.substr(pos + 1);
+        if(key == "--benchmark_filter") args.filter = value;
+        else if(key == "--benchmark_repetitions") args.repetitions = std::max(1, std::stoi(value));
+        else if(key == "--benchmark_min_time") args.mintime = std::stod(value);
+        else if(key == "--benchmark_out") args.out = value;
+        else if(key == "--benchmark_list_tests") args.list = true;
+        else errorif(true, "Unknown command-line argument `", arg, "`.");
+    }
+    return args;
+}
+
+/// Execute a benchmark with given number of iterations of its timed loop.
+auto execute(Benchmark const& benchmark, Index iterations) -> BenchmarkState
+{
+    BenchmarkState state(iterations);
+    benchmark.fn(state);
+    errorif(state.keepRunning(), "Benchmark `", benchmark.name, "` did not complete its timed loop.");
+    return state;
+}
+
+/// Execute a benchmark with enough iterations of its timed loop for the measured time to exceed the minimum time.
+auto run(Benchmark const& benchmark, double mintime) -> BenchmarkRun
+{
+    Index iterations = 1;
+    while(true)
+    {
+        const auto state = execute(benchmark, iterations);
+        const auto time = state.realTime();
+        if(time >= mintime || iterations >= 1000000000)
+            return { iterations, 1e9 * time / iterations, 1e9 * state.cpuTime() / iterations };
+        // Estimate the number of iterations needed, but increase it by at most 10x in each attempt
+        const auto factor = time > 0.0 ? std::min(10.0, 1.4 * mintime / time) : 10.0;
+        iterations = std::max<Index>(iterations + 1, std::ceil(iterations * factor));
+    }
+}
+
+/// Return the measurements of a run as a Data object in the format of Google Benchmark.
+auto encode(String const& name, String const& runtype, String const& aggregate, Index repetitions, Index repetition, BenchmarkRun const& run) -> Data
+{
+    Data data;
+    data["name"] = aggregate.empty() ? name : name + "_" + aggregate;
+    data["run_name"] = name;
+    data["run_type"] = runtype;
+    data["repetitions"] = repetitions;
+    if(aggregate.empty())
+        data["repetition_index"] = repetition;
+    else data["aggregate_name"] = aggregate;
+    data["threads"] = 1;
+    data["iterations"] = run.iterations;
+    data["real_time"] = run.realtime;
+    data["cpu_time"] = run.cputime;
+    data["time_unit"] = String("ns");
+    return data;
+}
+
+/// Return the mean, median and standard deviation of the measurements in the repetitions of a benchmark.
+auto aggregates(Vec<BenchmarkRun> const& runs) -> Vec<Pair<String, BenchmarkRun>>
+{
+    const auto N = runs.size();
+
+    auto stats = [&](auto member)
+    {
+        Vec<double> values;
+        for(auto const& run : runs)
+            values.push_back(run.*member);
+        std::sort(values.begin(), values.end());
+        double mean = 0.0;
+        for(auto value : values)
+            mean += value / N;
+        double variance = 0.0;
+        for(auto value : values)
+            variance += (value - mean) * (value - mean) / std::max<Index>(N - 1, 1);
+        const auto median = N % 2 ? values[N/2] : 0.5 * (values[N/2 - 1] + values[N/2]);
+        return std::array<double, 3>{ mean, median, std::sqrt(variance) };
+    };
+
+    const auto real = stats(&BenchmarkRun::realtime);
+    const auto cpu = stats(&BenchmarkRun::cputime);
+
+    return {
+        { "mean",   { runs.front().iterations, real[0], cpu[0] } },
+        { "median", { runs.front().iterations, real[1], cpu[1] } },
+        { "stddev", { runs.front().iterations, real[2], cpu[2] } },
+    };
+}
+
+/// Print a row of the table of results in the console.
+auto print(String const& name, BenchmarkRun const& run) -> void
+{
+    std::cout << std::left << std::setw(60) << name << std::right
+              << std::setw(16) << std::fixed << std::setprecision(0) << run.realtime << " ns"
+              << std::setw(16) << run.cputime << " ns"
+              << std::setw(12) << run.iterations << std::endl;
+}
+
+/// Return the current date and time in ISO 8601 format.
+auto currentDate() -> String
+{
+    const auto now = std::time(nullptr);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    return buffer;
+}
+
+} // namespace
+
+BenchmarkState::BenchmarkState(Index iterations)
+: miterations(iterations), mremaining(iterations)
+{}
+
+auto BenchmarkState::keepRunning() -> bool
+{
+    if(mremaining == 0)
+    {
+        if(mrunning)
+            pauseTiming();
+        return false;
+    }
+    if(mremaining == miterations && !mrunning)
+        resumeTiming();
+    --mremaining;
+    return true;
+}
+
+auto BenchmarkState::pauseTiming() -> void
+{
+    errorif(!mrunning, "Cannot pause the timer of a benchmark that is not running.");
+    mrealtime += elapsed(mrealstart);
+    mcputime += static_cast<double>(std::clock() - mcpustart) / CLOCKS_PER_SEC;
+    mrunning = false;
+}
+
+auto BenchmarkState::resumeTiming() -> void
+{
+    errorif(mrunning, "Cannot resume the timer of a benchmark that is already running.");
+    mrunning = true;
+    mcpustart = std::clock();
+    mrealstart = time();
+}
+
+auto BenchmarkState::iterations() const -> Index
+{
+    return miterations;
+}
+
+auto BenchmarkState::realTime() const -> double
+{
+    return mrealtime;
+}
+
+auto BenchmarkState::cpuTime() const -> double
+{
+    return mcputime;
+}
+
+auto registerBenchmark(String const& name, BenchmarkFn const& fn) -> void
+{
+    benchmarks().push_back({ name, fn });
+}
+
+auto runBenchmarks(int argc, char const* argv[]) -> int
+{
+    const auto args = parseArgs(argc, argv);
+    const std::regex filter(args.filter);
+
+    Vec<Data> results;
+
+    if(!args.list)
+    {
+        std::cout << std::left << std::setw(60) << "Benchmark" << std::right
+                  << std::setw(19) << "Time" << std::setw(19) << "CPU" << std::setw(12) << "Iterations" << std::endl;
+        std::cout << String(110, '-') << std::endl;
+    }
+
+    for(auto const& benchmark : benchmarks())
+    {
+        if(!std::regex_search(benchmark.name, filter))
+            continue;
+
+        if(args.list)
+        {
+            std::cout << benchmark.name << std::endl;
+            continue;
+        }
+
+        Vec<BenchmarkRun> runs;
+        for(auto i = 0; i < args.repetitions; ++i)
+        {
+            runs.push_back(run(benchmark, args.mintime));
+            print(benchmark.name, runs.back());
+            results.push_back(encode(benchmark.name, "iteration", "", args.repetitions, i, runs.back()));
+        }
+
+        if(args.repetitions > 1)
+        {
+            for(auto const& [aggregate, run] : aggregates(runs))
+            {
+                print(benchmark.name + "_" + aggregate, run);
+                results.push_back(encode(benchmark.name, "aggregate", aggregate, args.repetitions, 0, run));
+            }
+        }
+    }
+
+    if(!args.out.empty())
+    {
+        Data context;
+        context["date"] = currentDate();
+        context["executable"] = String(argv[0]);
+        context["num_cpus"] = std::thread::hardware_concurrency();
+#ifdef NDEBUG
+        context["library_build_type"] = String("release");
+#else
+        context["library_build_type"] = String("debug");
+#endif
+
+        Data output;
+        output["context"] = context;
+        output["benchmarks"] = results;
+        output.saveJson(args.out);
+    }
+
+    return 0;
+}
+
+} // namespace Reaktoro
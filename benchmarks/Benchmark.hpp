@@ -0,0 +1,108 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <ctime>
+
+// Reaktoro includes
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to control the timed loop of a benchmark.
+/// The code to be measured must be placed in a loop of the form
+/// `while(state.keepRunning()) { ... }`, with any setup code placed before
+/// it. Only the time spent inside this loop, excluding the parts between
+/// @ref pauseTiming and @ref resumeTiming, is measured.
+class BenchmarkState
+{
+public:
+    /// Construct a BenchmarkState object with given number of iterations for the timed loop.
+    explicit BenchmarkState(Index iterations);
+
+    /// Return true if there are iterations left in the timed loop.
+    /// The timer is started in the first call and stopped in the last one.
+    auto keepRunning() -> bool;
+
+    /// Pause the timer (e.g., to reset the inputs of the benchmarked code).
+    auto pauseTiming() -> void;
+
+    /// Resume the timer after a call to @ref pauseTiming.
+    auto resumeTiming() -> void;
+
+    /// Return the number of iterations of the timed loop.
+    auto iterations() const -> Index;
+
+    /// Return the measured wall time of the timed loop (in s).
+    auto realTime() const -> double;
+
+    /// Return the measured processor time of the timed loop (in s).
+    auto cpuTime() const -> double;
+
+private:
+    /// The number of iterations of the timed loop.
+    Index miterations = 0;
+
+    /// The number of iterations of the timed loop not yet started.
+    Index mremaining = 0;
+
+    /// The time point at which the timer was last started or resumed.
+    Time mrealstart;
+
+    /// The processor time at which the timer was last started or resumed.
+    std::clock_t mcpustart = 0;
+
+    /// The accumulated wall time of the timed loop (in s).
+    double mrealtime = 0.0;
+
+    /// The accumulated processor time of the timed loop (in s).
+    double mcputime = 0.0;
+
+    /// The flag indicating if the timer is running.
+    bool mrunning = false;
+};
+
+/// The type of functions that implement benchmarks.
+using BenchmarkFn = Fn<void(BenchmarkState&)>;
+
+/// Register a benchmark with given name to be executed by @ref runBenchmarks.
+/// @param name The name of the benchmark in the form `Group/Case` (e.g. `EquilibriumSolver::solve/Cold`)
+/// @param fn The function implementing the benchmark
+auto registerBenchmark(String const& name, BenchmarkFn const& fn) -> void;
+
+/// Execute the registered benchmarks using the given command-line arguments.
+/// The supported arguments, similar to those of Google Benchmark, are:
+///   - `--benchmark_filter=<regex>`: execute only benchmarks whose names match the regular expression
+///   - `--benchmark_repetitions=<n>`: repeat each benchmark `n` times and report mean, median and standard deviation
+///   - `--benchmark_min_time=<s>`: the minimum time (in s) of the timed loop used to determine the number of iterations
+///   - `--benchmark_out=<file>`: save the results in a JSON file using the format of Google Benchmark
+///   - `--benchmark_list_tests`: list the names of the benchmarks without executing them
+/// @return The exit status of the program
+auto runBenchmarks(int argc, char const* argv[]) -> int;
+
+/// Prevent the compiler from optimizing away the computation of a value.
+template<typename T>
+auto doNotOptimize(T const& value) -> void
+{
+    static T const* volatile sink = nullptr;
+    sink = &value;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,201 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+namespace {
+
+/// Register a benchmark for the evaluation of the chemical properties of a system with given chemical state.
+/// The species amounts alternate between two compositions in consecutive updates, since the evaluation of
+/// the thermodynamic models of a phase is skipped when its conditions are unchanged (see ChemicalProps::update).
+auto registerChemicalPropsUpdate(String const& name, Fn<ChemicalState()> const& createState) -> void
+{
+    registerBenchmark("ChemicalProps::update/" + name, [=](BenchmarkState& bstate)
+    {
+        const auto state = createState();
+        const auto T = state.temperature();
+        const auto P = state.pressure();
+        const ArrayXr n0 = state.speciesAmounts();
+
+        ArrayXr n1 = n0;
+        n1[0] *= 1.001; // change the composition of the phase, not only its size
+
+        ChemicalProps props(state.system());
+
+        auto k = 0;
+
+        while(bstate.keepRunning())
+        {
+            props.update(T, P, k++ % 2 ? n1 : n0);
+            doNotOptimize(props);
+        }
+    });
+}
+
+} // namespace
+
+auto registerChemicalPropsBenchmarks() -> void
+{
+    registerChemicalPropsUpdate("DebyeHuckel", []
+    {
+        PhreeqcDatabase db("phreeqc.dat");
+
+        AqueousPhase solution(speciate("H O C Na Cl Ca Mg"));
+        solution.set(ActivityModelDebyeHuckel());
+
+        ChemicalSystem system(db, solution);
+
+        ChemicalState state(system);
+        state.temperature(60.0, "celsius");
+        state.pressure(100.0, "bar");
+        state.setSpeciesAmounts(1e-6);
+        state.set("H2O", 1.0, "kg");
+        state.set("Na+", 1.0, "mol");
+        state.set("Cl-", 1.0, "mol");
+        return state;
+    });
+
+    registerChemicalPropsUpdate("Pitzer", []
+    {
+        PhreeqcDatabase db("pitzer.dat");
+
+        AqueousPhase solution(speciate("H O C Na Cl Ca Mg K S"));
+        solution.set(ActivityModelPitzer());
+
+        ChemicalSystem system(db, solution);
+
+        ChemicalState state(system);
+        state.temperature(60.0, "celsius");
+        state.pressure(100.0, "bar");
+        state.setSpeciesAmounts(1e-6);
+        state.set("H2O"  , 1.0, "kg");
+        state.set("Na+"  , 4.0, "mol");
+        state.set("Cl-"  , 4.0, "mol");
+        state.set("Ca+2" , 0.2, "mol");
+        state.set("SO4-2", 0.1, "mol");
+        return state;
+    });
+
+    registerChemicalPropsUpdate("ExtendedUNIQUAC", []
+    {
+        const auto db = Database::embedded("ExtendedUNIQUAC.v2024.yaml");
+        const auto params = Params::embedded("ExtendedUNIQUAC.v2024.yaml");
+
+        AqueousPhase solution(speciate("H O Na Ba Cl C S"));
+        solution.set(ActivityModelExtendedUNIQUAC(params));
+
+        ChemicalSystem system(db, solution);
+
+        ChemicalState state(system);
+        state.temperature(60.0, "celsius");
+        state.pressure(100.0, "bar");
+        state.setSpeciesAmounts(1e-6);
+        state.set("H2O"  , 1.0, "kg");
+        state.set("Na+"  , 4.0, "mol");
+        state.set("Cl-"  , 3.0, "mol");
+        state.set("Ba+2" , 0.5, "mol");
+        state.set("SO4-2", 1.0, "mol");
+        state.set("CO2"  , 0.2, "mol");
+        return state;
+    });
+
+    registerChemicalPropsUpdate("PengRobinson", []
+    {
+        PhreeqcDatabase db("phreeqc.dat");
+
+        GaseousPhase gases("CO2(g) H2O(g) CH4(g) N2(g)");
+        gases.set(ActivityModelPengRobinson());
+
+        ChemicalSystem system(db, gases);
+
+        ChemicalState state(system);
+        state.temperature(60.0, "celsius");
+        state.pressure(100.0, "bar");
+        state.set("CO2(g)", 1.0, "mol");
+        state.set("H2O(g)", 0.1, "mol");
+        state.set("CH4(g)", 0.5, "mol");
+        state.set("N2(g)" , 0.2, "mol");
+        return state;
+    });
+
+    // Compare ChemicalProps::clearDerivatives with zeroing out the derivatives by serializing the chemical
+    // properties into an ArrayStream<double> object and deserializing them back (the previous approach
+    // used in EquilibriumSolver). A large chemical system is used so that copying the property arrays is noticeable.
+    const auto registerClearDerivatives = [](String const& name, Fn<void(ChemicalProps&)> const& clear)
+    {
+        registerBenchmark("ChemicalProps::clearDerivatives/" + name, [=](BenchmarkState& bstate)
+        {
+            PhreeqcDatabase db("phreeqc.dat");
+
+            AqueousPhase solution(speciate("H O C Na Cl Ca Mg K S Fe Si Al N P"));
+            solution.set(ActivityModelDavies());
+
+            GaseousPhase gases(speciate("H O C N S"));
+            gases.set(ActivityModelPengRobinson());
+
+            MineralPhases minerals(speciate("H O C Na Cl Ca Mg K S Fe Si Al"));
+
+            ChemicalSystem system(db, solution, gases, minerals);
+
+            ChemicalState state(system);
+            state.temperature(60.0, "celsius");
+            state.pressure(100.0, "bar");
+            state.setSpeciesAmounts(1e-6);
+            state.set("H2O", 1.0, "kg");
+
+            auto T = state.temperature();
+            auto P = state.pressure();
+            auto n = state.speciesAmounts();
+
+            // Evaluate the chemical properties with seeded temperature so that they carry derivatives
+            ChemicalProps seeded(system);
+            autodiff::seed(T);
+            seeded.update(T, P, n);
+            autodiff::unseed(T);
+
+            ChemicalProps props(seeded);
+
+            while(bstate.keepRunning())
+            {
+                bstate.pauseTiming();
+                props = seeded;
+                bstate.resumeTiming();
+                clear(props);
+                doNotOptimize(props);
+            }
+        });
+    };
+
+    registerClearDerivatives("ClearDerivatives", [](ChemicalProps& props)
+    {
+        props.clearDerivatives();
+    });
+
+    registerClearDerivatives("SerializeDeserialize", [](ChemicalProps& props)
+    {
+        ArrayStream<double> stream;
+        props.serialize(stream);
+        props.deserialize(stream);
+    });
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,97 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+
+auto registerDatabaseBenchmarks() -> void
+{
+    // The embedded databases in Reaktoro format (in both YAML and JSON formats when available)
+    const Strings databases = {
+        "supcrt98.yaml", "supcrt98.json",
+        "supcrt07.yaml", "supcrt07.json",
+        "supcrt16.yaml", "supcrt16.json",
+        "supcrtbl.yaml", "supcrtbl.json",
+        "supcrt98-organics.yaml", "supcrt98-organics.json",
+        "supcrt07-organics.yaml", "supcrt07-organics.json",
+        "supcrt16-organics.yaml", "supcrt16-organics.json",
+        "supcrtbl-organics.yaml", "supcrtbl-organics.json",
+        "nasa-cea.yaml", "nasa-cea.json",
+        "ExtendedUNIQUAC.v1997.yaml",
+        "ExtendedUNIQUAC.v2005.yaml",
+        "ExtendedUNIQUAC.v2023.yaml",
+        "ExtendedUNIQUAC.v2024.yaml",
+    };
+
+    for(auto const& database : databases)
+    {
+        registerBenchmark("Data::parse/" + database, [=](BenchmarkState& bstate)
+        {
+            const auto text = Embedded::get("databases/reaktoro/" + database);
+            while(bstate.keepRunning())
+            {
+                const auto data = Data::parse(text);
+                doNotOptimize(data);
+            }
+        });
+    }
+
+    registerBenchmark("ChemicalSystem::ChemicalSystem/Phreeqc", [](BenchmarkState& bstate)
+    {
+        PhreeqcDatabase db("phreeqc.dat");
+
+        AqueousPhase solution(speciate("H O C Na Cl Ca Mg K S Fe Si Al"));
+        solution.set(ActivityModelDavies());
+
+        GaseousPhase gases(speciate("H O C S"));
+        gases.set(ActivityModelPengRobinson());
+
+        MineralPhases minerals(speciate("H O C Na Cl Ca Mg K S Fe Si Al"));
+
+        while(bstate.keepRunning())
+        {
+            ChemicalSystem system(db, solution, gases, minerals);
+            doNotOptimize(system);
+        }
+    });
+
+    registerBenchmark("ChemicalSystem::ChemicalSystem/Supcrt", [](BenchmarkState& bstate)
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution(speciate("H O C Na Cl Ca Mg K S Fe Si Al"));
+        solution.set(ActivityModelHKF());
+
+        GaseousPhase gases(speciate("H O C S"));
+        gases.set(ActivityModelPengRobinson());
+
+        MineralPhases minerals(speciate("H O C Na Cl Ca Mg K S Fe Si Al"));
+
+        while(bstate.keepRunning())
+        {
+            ChemicalSystem system(db, solution, gases, minerals);
+            doNotOptimize(system);
+        }
+    });
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,229 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+namespace {
+
+/// Return the chemical system of a brine in contact with carbonate minerals and CO2.
+auto createCarbonateSystem() -> ChemicalSystem
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg"));
+    solution.set(ActivityModelDavies());
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+
+    MineralPhases minerals("Calcite Dolomite Halite");
+
+    return ChemicalSystem(db, solution, gases, minerals);
+}
+
+/// Return the initial chemical state of the brine in contact with carbonate minerals and CO2.
+auto createCarbonateState(ChemicalSystem const& system) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O"     , 1.0, "kg");
+    state.set("Na+"     , 1.0, "mol");
+    state.set("Cl-"     , 1.0, "mol");
+    state.set("CO2(g)"  , 1.0, "mol");
+    state.set("Calcite" , 1.0, "mol");
+    state.set("Dolomite", 1.0, "mol");
+    return state;
+}
+
+/// Return the chemical system of a Pitzer brine in contact with calcite, dolomite, halite and gypsum.
+auto createBrineSystem() -> ChemicalSystem
+{
+    PhreeqcDatabase db("pitzer.dat");
+
+    AqueousPhase solution(speciate("H O C Ca Cl Na K Mg S"));
+    solution.set(ActivityModelPitzer());
+
+    return ChemicalSystem(db, solution, MineralPhases("Calcite Dolomite Halite Gypsum"));
+}
+
+/// Return the initial chemical state of the Pitzer brine in contact with calcite and dolomite.
+auto createBrineState(ChemicalSystem const& system) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.set("H2O"     , 1.0, "kg");
+    state.set("Na+"     , 4.0, "mol");
+    state.set("Ca+2"    , 0.2, "mol");
+    state.set("Mg+2"    , 0.1, "mol");
+    state.set("SO4-2"   , 0.1, "mol");
+    state.set("K+"      , 0.1, "mol");
+    state.set("Cl-"     , 4.4, "mol");
+    state.set("CO2"     , 0.1, "mol");
+    state.set("Calcite" , 1.0, "mol");
+    state.set("Dolomite", 1.0, "mol");
+    return state;
+}
+
+} // namespace
+
+auto registerEquilibriumBenchmarks() -> void
+{
+    registerBenchmark("EquilibriumSolver::solve/Cold", [](BenchmarkState& bstate)
+    {
+        const auto system = createCarbonateSystem();
+        const auto state0 = createCarbonateState(system);
+
+        EquilibriumSolver solver(system);
+
+        ChemicalState state(state0);
+
+        while(bstate.keepRunning())
+        {
+            bstate.pauseTiming();
+            state = state0;
+            bstate.resumeTiming();
+            solver.solve(state);
+        }
+    });
+
+    registerBenchmark("EquilibriumSolver::solve/Warm", [](BenchmarkState& bstate)
+    {
+        const auto system = createCarbonateSystem();
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        EquilibriumSolver solver(specs);
+
+        EquilibriumConditions conditions(specs);
+        conditions.pressure(100.0, "bar");
+
+        ChemicalState state = createCarbonateState(system);
+        conditions.temperature(60.0, "celsius");
+        solver.solve(state, conditions);
+
+        // Alternate between two nearby temperatures so that each calculation starts from a close equilibrium state
+        auto i = 0;
+        while(bstate.keepRunning())
+        {
+            conditions.temperature(++i % 2 ? 61.0 : 60.0, "celsius");
+            solver.solve(state, conditions);
+        }
+    });
+
+    registerBenchmark("SmartEquilibriumSolver::solve/Learn", [](BenchmarkState& bstate)
+    {
+        const auto system = createCarbonateSystem();
+        const auto state0 = createCarbonateState(system);
+
+        ChemicalState state(state0);
+
+        while(bstate.keepRunning())
+        {
+            bstate.pauseTiming();
+            SmartEquilibriumSolver solver(system); // a new solver without learning data so that no prediction is possible
+            state = state0;
+            bstate.resumeTiming();
+            solver.solve(state);
+        }
+    });
+
+    registerBenchmark("SmartEquilibriumSolver::solve/Predict", [](BenchmarkState& bstate)
+    {
+        const auto system = createCarbonateSystem();
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        SmartEquilibriumSolver solver(specs);
+
+        EquilibriumConditions conditions(specs);
+        conditions.temperature(60.0, "celsius");
+        conditions.pressure(100.0, "bar");
+
+        // Learn the equilibrium state at 60 °C, which is then used to predict those at slightly different temperatures
+        ChemicalState state0 = createCarbonateState(system);
+        solver.solve(state0, conditions);
+
+        ChemicalState state(state0);
+
+        auto i = 0;
+        while(bstate.keepRunning())
+        {
+            bstate.pauseTiming();
+            state = state0;
+            conditions.temperature(++i % 2 ? 60.1 : 59.9, "celsius");
+            bstate.resumeTiming();
+            solver.solve(state, conditions);
+        }
+    });
+
+    // The strong scaling of ParallelEquilibriumSolver: the same batch of independent cells at different
+    // temperatures and pressures is equilibrated with 1, 2, 4, ... threads sharing the same ChemicalSystem object.
+    const auto maxthreads = std::max<Index>(1, std::thread::hardware_concurrency());
+
+    for(Index numthreads = 1; numthreads <= maxthreads; numthreads = numthreads < maxthreads ? std::min(2 * numthreads, maxthreads) : maxthreads + 1)
+    {
+        registerBenchmark("ParallelEquilibriumSolver::solve/Threads:" + std::to_string(numthreads), [=](BenchmarkState& bstate)
+        {
+            const auto numcells = 200;
+
+            const auto system = createBrineSystem();
+            const auto state0 = createBrineState(system);
+
+            EquilibriumSpecs specs(system);
+            specs.temperature();
+            specs.pressure();
+
+            Vec<EquilibriumConditions> conditions;
+            conditions.reserve(numcells);
+
+            for(auto i = 0; i < numcells; ++i)
+            {
+                EquilibriumConditions cellconditions(specs);
+                cellconditions.temperature(25.0 + 75.0 * i / numcells, "celsius");
+                cellconditions.pressure(1.0 + 99.0 * i / numcells, "bar");
+                conditions.push_back(cellconditions);
+            }
+
+            ParallelEquilibriumSolver solver(specs, numthreads);
+
+            Vec<ChemicalState> states;
+            Vec<EquilibriumResult> results;
+
+            while(bstate.keepRunning())
+            {
+                bstate.pauseTiming();
+                states.assign(numcells, state0);
+                bstate.resumeTiming();
+                solver.solve(states, conditions, results);
+            }
+        });
+    }
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,76 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+
+auto registerKineticsBenchmarks() -> void
+{
+    registerBenchmark("KineticsSolver::solve/Halite", [](BenchmarkState& bstate)
+    {
+        // The surface area of a cube per volume (in m2/m3)
+        const auto Abar = 6.0;
+
+        // The dissolution rate model for halite (NaCl)
+        auto ratefn = [=](ChemicalProps const& props)
+        {
+            AqueousProps aprops(props);
+            auto k0 = std::pow(10.0, -0.21); // reaction rate constant at 25 °C from Palandri and Kharaka (2004)
+            auto q = props.phaseProps("Halite").volume(); // volume in m3
+            auto Omega = aprops.saturationRatio("Halite");
+            return q * Abar * k0 * (1 - Omega);
+        };
+
+        PhreeqcDatabase db("phreeqc.dat");
+
+        ChemicalSystem system(db,
+            AqueousPhase("H2O H+ OH- Na+ Cl-").set(ActivityModelPhreeqc(db)),
+            MineralPhase("Halite"),
+            GeneralReaction("Halite = Na+ + Cl-").setRateModel(ratefn)
+        );
+
+        ChemicalState state0(system);
+        state0.set("H2O", 1.0, "kg");
+        state0.scalePhaseVolume("Halite", 1.0, "cm3");
+
+        KineticsSolver solver(system);
+
+        ChemicalState state(state0);
+
+        const auto dt = 60.0; // time step (in seconds)
+
+        // Restart from the initial state every few steps so that all iterations perform similar work
+        auto i = 0;
+        while(bstate.keepRunning())
+        {
+            if(i++ % 10 == 0)
+            {
+                bstate.pauseTiming();
+                state = state0;
+                bstate.resumeTiming();
+            }
+            solver.solve(state, dt);
+        }
+    });
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,97 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+namespace {
+
+/// Return a memoized version of given function that caches only the arguments used in the last call without using ThreadLocal.
+/// This is how memoizeLast was implemented before its caches were kept per thread, and it is used here to measure the
+/// overhead of ThreadLocal in single-threaded applications.
+auto memoizeLastWithoutThreadLocal(Fn<real(real const&, real const&)> f) -> Fn<real(real const&, real const&)>
+{
+    Tuple<real, real> cache;
+    real result = {};
+    auto firsttime = true;
+    return [=](real const& T, real const& P) mutable -> real
+    {
+        if(Memoization::isDisabled())
+            return f(T, P);
+        if(detail::sameValues(cache, std::tie(T, P)) && !firsttime)
+            return result;
+        detail::assignValues(cache, std::tie(T, P));
+        firsttime = false;
+        return result = f(T, P);
+    };
+}
+
+/// The function memoized in the benchmarks (cheap, so that the overhead of memoization dominates).
+auto fn = [](real const& T, real const& P) -> real { return T * P; };
+
+/// Execute a benchmark in which a memoized function is called with the same arguments (i.e., cache hits).
+auto benchmarkMemoizedCalls(BenchmarkState& bstate, Fn<real(real const&, real const&)> const& g) -> void
+{
+    const real T = 298.15;
+    const real P = 1.0e5;
+    while(bstate.keepRunning())
+        for(auto i = 0; i < 1000; ++i)
+            doNotOptimize(g(T, P));
+}
+
+/// Execute a benchmark in which a memoized function is called with alternating arguments (i.e., cache misses).
+auto benchmarkMemoizedCallsWithMisses(BenchmarkState& bstate, Fn<real(real const&, real const&)> const& g) -> void
+{
+    const real T1 = 298.15;
+    const real T2 = 348.15;
+    const real P = 1.0e5;
+    while(bstate.keepRunning())
+        for(auto i = 0; i < 1000; ++i)
+            doNotOptimize(g(i % 2 ? T1 : T2, P));
+}
+
+} // namespace
+
+auto registerMemoizationBenchmarks() -> void
+{
+    // These benchmarks are executed in a single thread and measure 1000 calls of the memoized function per iteration
+    registerBenchmark("memoizeLast/Hits", [](BenchmarkState& bstate)
+    {
+        benchmarkMemoizedCalls(bstate, memoizeLast(Fn<real(real const&, real const&)>(fn)));
+    });
+
+    registerBenchmark("memoizeLast/HitsWithoutThreadLocal", [](BenchmarkState& bstate)
+    {
+        benchmarkMemoizedCalls(bstate, memoizeLastWithoutThreadLocal(fn));
+    });
+
+    registerBenchmark("memoizeLast/Misses", [](BenchmarkState& bstate)
+    {
+        benchmarkMemoizedCallsWithMisses(bstate, memoizeLast(Fn<real(real const&, real const&)>(fn)));
+    });
+
+    registerBenchmark("memoizeLast/MissesWithoutThreadLocal", [](BenchmarkState& bstate)
+    {
+        benchmarkMemoizedCallsWithMisses(bstate, memoizeLastWithoutThreadLocal(fn));
+    });
+}
+
+} // namespace Reaktoro
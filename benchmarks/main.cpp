@@ -0,0 +1,53 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Performance suite of Reaktoro with microbenchmarks (e.g., evaluation of chemical properties with
+// different activity models, parsing of embedded databases) and macrobenchmarks (e.g., chemical
+// equilibrium and kinetics calculations). All benchmarks use fixed inputs so that their results
+// can be compared between releases.
+//
+// Usage: reaktoro-benchmarks [--benchmark_filter=<regex>] [--benchmark_repetitions=<n>]
+//                            [--benchmark_min_time=<s>] [--benchmark_out=<file.json>]
+//                            [--benchmark_list_tests]
+//--------------------------------------------------------------------------------------------------
+
+// Benchmark includes
+#include "Benchmark.hpp"
+
+namespace Reaktoro {
+
+auto registerChemicalPropsBenchmarks() -> void;
+auto registerDatabaseBenchmarks() -> void;
+auto registerEquilibriumBenchmarks() -> void;
+auto registerKineticsBenchmarks() -> void;
+auto registerMemoizationBenchmarks() -> void;
+
+} // namespace Reaktoro
+
+int main(int argc, char const* argv[])
+{
+    using namespace Reaktoro;
+
+    registerMemoizationBenchmarks();
+    registerDatabaseBenchmarks();
+    registerChemicalPropsBenchmarks();
+    registerEquilibriumBenchmarks();
+    registerKineticsBenchmarks();
+
+    return runBenchmarks(argc, argv);
+}
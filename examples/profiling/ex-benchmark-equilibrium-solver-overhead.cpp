@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+//--------------------------------------------------------------------------------------------------
+// Microbenchmark for the per-call overhead of EquilibriumSolver::solve.
+//
+// The same EquilibriumSolver object is used to re-equilibrate a chemical state that is already in
+// equilibrium (warm-start), so that each call converges in very few iterations and the measured
+// time is dominated by the work done before and after the Optima solve (e.g., setting up the
+// optimization problem, updating the chemical state). Execute this program before and after
+// changes in EquilibriumSolver to compare the per-call overhead.
+//
+// Usage: ex-benchmark-equilibrium-solver-overhead [number of calls]
+//--------------------------------------------------------------------------------------------------
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+int main(int argc, char const *argv[])
+{
+    const auto ncalls = argc > 1 ? std::stoi(argv[1]) : 10000;
+
+    PhreeqcDatabase db("phreeqc.dat");
+
+    AqueousPhase solution("H2O H+ OH- Na+ Cl- HCO3- CO3-2 CO2");
+    solution.set(ActivityModelDavies());
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+    gases.set(ActivityModelIdealGas());
+
+    ChemicalSystem system(db, solution, gases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(60.0, "celsius");
+    conditions.pressure(100.0, "bar");
+
+    EquilibriumSolver solver(specs);
+
+    ChemicalState state(system);
+    state.set("H2O",    1.0, "kg");
+    state.set("Na+",    1.0, "mol");
+    state.set("Cl-",    1.0, "mol");
+    state.set("CO2(g)", 1.0, "mol");
+
+    auto result = solver.solve(state, conditions); // the first calculation is a cold-start one
+
+    errorif(result.failed(), "Equilibrium calculation failed.");
+
+    Stopwatch stopwatch;
+    stopwatch.reset();
+
+    auto iterations = 0;
+
+    for(auto i = 0; i < ncalls; ++i)
+    {
+        stopwatch.start();
+        result = solver.solve(state, conditions);
+        stopwatch.pause();
+        iterations += result.iterations();
+    }
+
+    errorif(result.failed(), "Equilibrium calculation failed.");
+
+    const auto total = stopwatch.time();
+
+    std::cout << "Number of calls to EquilibriumSolver::solve: " << ncalls << std::endl;
+    std::cout << "Average number of iterations per call:       " << double(iterations)/ncalls << std::endl;
+    std::cout << "Total time (in s):                           " << total << std::endl;
+    std::cout << "Average time per call (in μs):               " << total/ncalls * 1e6 << std::endl;
+
+    return 0;
+}